@@ -1,15 +1,17 @@
 from esphome.const import (
     DEVICE_CLASS_TEMPERATURE,
     DEVICE_CLASS_POWER,
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    CONF_TYPE,
     STATE_CLASS_MEASUREMENT,
     UNIT_CELSIUS,
     UNIT_WATT,
 )
 import esphome.codegen as cg
 import esphome.config_validation as cv
-from esphome.components import uart, climate, sensor, select, switch, binary_sensor
+from esphome.components import uart, climate, sensor, select, switch, binary_sensor, text_sensor
 
-AUTO_LOAD = ["switch", "sensor", "select", "binary_sensor"]
+AUTO_LOAD = ["switch", "sensor", "select", "binary_sensor", "text_sensor"]
 DEPENDENCIES = ["uart"]
 
 panasonic_ac_ns = cg.esphome_ns.namespace("panasonic_ac")
@@ -20,6 +22,7 @@ panasonic_ac_cnt_ns = panasonic_ac_ns.namespace("CNT")
 PanasonicACCNT = panasonic_ac_cnt_ns.class_("PanasonicACCNT", PanasonicAC)
 panasonic_ac_wlan_ns = panasonic_ac_ns.namespace("WLAN")
 PanasonicACWLAN = panasonic_ac_wlan_ns.class_("PanasonicACWLAN", PanasonicAC)
+PanasonicACAuto = panasonic_ac_ns.class_("PanasonicACAuto", PanasonicAC)
 
 PanasonicACSwitch = panasonic_ac_ns.class_(
     "PanasonicACSwitch", switch.Switch, cg.Component
@@ -35,19 +38,37 @@ CONF_OUTSIDE_TEMPERATURE = "outside_temperature"
 CONF_OUTSIDE_TEMPERATURE_OFFSET = "outside_temperature_offset"
 CONF_CURRENT_TEMPERATURE_SENSOR = "current_temperature_sensor"
 CONF_CURRENT_TEMPERATURE_OFFSET = "current_temperature_offset"
+CONF_CURRENT_TEMPERATURE_MIN_INTERVAL = "current_temperature_min_interval"
 CONF_NANOEX_SWITCH = "nanoex_switch"
 CONF_ECO_SWITCH = "eco_switch"
 CONF_ECONAVI_SWITCH = "econavi_switch"
 CONF_MILD_DRY_SWITCH = "mild_dry_switch"
 CONF_CURRENT_POWER_CONSUMPTION = "current_power_consumption"
 CONF_DEFROST_SENSOR = "defrost_sensor"
+CONF_UNKNOWN_FIELDS_SENSOR = "unknown_fields_sensor"
+CONF_RX_TASK = "rx_task"
+CONF_PASSIVE = "passive"
+CONF_CONTROLLER_UART_ID = "controller_uart_id"
+CONF_FLIGHT_RECORDER_SIZE = "flight_recorder_size"
+CONF_COMMAND_DEBOUNCE = "command_debounce"
+CONF_COMMAND_MAX_DELAY = "command_max_delay"
+CONF_COMMAND_MAX_AGE = "command_max_age"
 CONF_WLAN = "wlan"
 CONF_CNT = "cnt"
+CONF_AUTO = "auto"
 
 HORIZONTAL_SWING_OPTIONS = ["auto", "left", "left_center", "center", "right_center", "right"]
 
 VERTICAL_SWING_OPTIONS = ["swing", "auto", "up", "up_center", "center", "down_center", "down"]
 
+# Features are only compiled in if at least one configured AC uses them
+SWITCH_DEFINES = {
+    CONF_NANOEX_SWITCH: "USE_PANASONIC_AC_NANOEX",
+    CONF_ECO_SWITCH: "USE_PANASONIC_AC_ECO",
+    CONF_ECONAVI_SWITCH: "USE_PANASONIC_AC_ECONAVI",
+    CONF_MILD_DRY_SWITCH: "USE_PANASONIC_AC_MILD_DRY",
+}
+
 SWITCH_SCHEMA = switch.switch_schema(PanasonicACSwitch).extend(cv.COMPONENT_SCHEMA)
 
 SELECT_SCHEMA = select.select_schema(PanasonicACSelect)
@@ -65,6 +86,13 @@ PANASONIC_COMMON_SCHEMA = {
     cv.Optional(CONF_NANOEX_SWITCH): SWITCH_SCHEMA,
     cv.Optional(CONF_OUTSIDE_TEMPERATURE_OFFSET): cv.int_range(min=-15, max=15),
     cv.Optional(CONF_CURRENT_TEMPERATURE_OFFSET): cv.int_range(min=-15, max=15),
+    cv.Optional(CONF_RX_TASK): cv.All(cv.boolean, cv.only_on_esp32),
+    cv.Optional(CONF_PASSIVE, default=False): cv.boolean,
+    cv.Optional(CONF_CONTROLLER_UART_ID): cv.use_id(uart.UARTComponent),
+    cv.Optional(CONF_FLIGHT_RECORDER_SIZE): cv.int_range(min=1, max=64),
+    cv.Optional(CONF_COMMAND_DEBOUNCE): cv.positive_time_period_milliseconds,
+    cv.Optional(CONF_COMMAND_MAX_DELAY): cv.positive_time_period_milliseconds,
+    cv.Optional(CONF_COMMAND_MAX_AGE): cv.positive_time_period_milliseconds,
 }
 
 PANASONIC_CNT_SCHEMA = {
@@ -72,6 +100,7 @@ PANASONIC_CNT_SCHEMA = {
     cv.Optional(CONF_ECONAVI_SWITCH): SWITCH_SCHEMA,
     cv.Optional(CONF_MILD_DRY_SWITCH): SWITCH_SCHEMA,
     cv.Optional(CONF_CURRENT_TEMPERATURE_SENSOR): cv.use_id(sensor.Sensor),
+    cv.Optional(CONF_CURRENT_TEMPERATURE_MIN_INTERVAL): cv.positive_time_period_milliseconds,
     cv.Optional(CONF_CURRENT_POWER_CONSUMPTION): sensor.sensor_schema(
         unit_of_measurement=UNIT_WATT,
         accuracy_decimals=0,
@@ -80,12 +109,29 @@ PANASONIC_CNT_SCHEMA = {
     ),
 }
 
-CONFIG_SCHEMA = cv.typed_schema(
+PANASONIC_WLAN_SCHEMA = {
+    cv.Optional(CONF_UNKNOWN_FIELDS_SENSOR): text_sensor.text_sensor_schema(
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+    ),
+}
+
+
+def validate_passive(config):
+    if CONF_CONTROLLER_UART_ID in config and not config[CONF_PASSIVE]:
+        raise cv.Invalid(f"{CONF_CONTROLLER_UART_ID} requires {CONF_PASSIVE}: true")
+    if config[CONF_TYPE] == CONF_AUTO and config[CONF_PASSIVE]:
+        raise cv.Invalid(f"{CONF_PASSIVE} requires the type to be set, detection has to transmit")
+    return config
+
+
+CONFIG_SCHEMA = cv.All(cv.typed_schema(
     {
-        CONF_WLAN: climate.climate_schema(PanasonicACWLAN).extend(PANASONIC_COMMON_SCHEMA).extend(uart.UART_DEVICE_SCHEMA),
+        CONF_WLAN: climate.climate_schema(PanasonicACWLAN).extend(PANASONIC_COMMON_SCHEMA).extend(PANASONIC_WLAN_SCHEMA).extend(uart.UART_DEVICE_SCHEMA),
         CONF_CNT: climate.climate_schema(PanasonicACCNT).extend(PANASONIC_COMMON_SCHEMA).extend(PANASONIC_CNT_SCHEMA).extend(uart.UART_DEVICE_SCHEMA),
+        # Detects the protocol at boot, accepts the options of both
+        CONF_AUTO: climate.climate_schema(PanasonicACAuto).extend(PANASONIC_COMMON_SCHEMA).extend(PANASONIC_CNT_SCHEMA).extend(PANASONIC_WLAN_SCHEMA).extend(uart.UART_DEVICE_SCHEMA),
     }
-)
+), validate_passive)
 
 
 async def to_code(config):
@@ -97,21 +143,58 @@ async def to_code(config):
         conf = config[CONF_HORIZONTAL_SWING_SELECT]
         swing_select = await select.new_select(conf, options=HORIZONTAL_SWING_OPTIONS)
         await cg.register_component(swing_select, conf)
+        if config[CONF_PASSIVE]:
+            cg.add(swing_select.set_read_only(True))
         cg.add(var.set_horizontal_swing_select(swing_select))
+        cg.add_define("USE_PANASONIC_AC_HORIZONTAL_SWING")
 
     if CONF_VERTICAL_SWING_SELECT in config:
         conf = config[CONF_VERTICAL_SWING_SELECT]
         swing_select = await select.new_select(conf, options=VERTICAL_SWING_OPTIONS)
         await cg.register_component(swing_select, conf)
+        if config[CONF_PASSIVE]:
+            cg.add(swing_select.set_read_only(True))
         cg.add(var.set_vertical_swing_select(swing_select))
+        cg.add_define("USE_PANASONIC_AC_VERTICAL_SWING")
 
     if CONF_OUTSIDE_TEMPERATURE in config:
         sens = await sensor.new_sensor(config[CONF_OUTSIDE_TEMPERATURE])
         cg.add(var.set_outside_temperature_sensor(sens))
+        cg.add_define("USE_PANASONIC_AC_OUTSIDE_TEMPERATURE")
 
     if CONF_DEFROST_SENSOR in config:
         sens = await binary_sensor.new_binary_sensor(config[CONF_DEFROST_SENSOR])
         cg.add(var.set_defrost_sensor(sens))
+        cg.add_define("USE_PANASONIC_AC_DEFROST")
+
+    if CONF_UNKNOWN_FIELDS_SENSOR in config:
+        sens = await text_sensor.new_text_sensor(config[CONF_UNKNOWN_FIELDS_SENSOR])
+        cg.add(var.set_unknown_fields_sensor(sens))
+        cg.add_define("USE_PANASONIC_AC_UNKNOWN_FIELDS_SENSOR")
+
+    if CONF_RX_TASK in config:
+        cg.add(var.set_rx_task(config[CONF_RX_TASK]))
+
+    if config[CONF_PASSIVE]:
+        cg.add(var.set_passive(True))
+        cg.add_define("USE_PANASONIC_AC_PASSIVE")
+
+        if CONF_CONTROLLER_UART_ID in config:
+            controller_uart = await cg.get_variable(config[CONF_CONTROLLER_UART_ID])
+            cg.add(var.set_controller_uart(controller_uart))
+
+    if CONF_FLIGHT_RECORDER_SIZE in config:
+        cg.add_define("USE_PANASONIC_AC_FLIGHT_RECORDER")
+        cg.add(var.set_flight_recorder_size(config[CONF_FLIGHT_RECORDER_SIZE]))
+
+    if CONF_COMMAND_DEBOUNCE in config:
+        cg.add(var.set_command_debounce(config[CONF_COMMAND_DEBOUNCE]))
+
+    if CONF_COMMAND_MAX_DELAY in config:
+        cg.add(var.set_command_max_delay(config[CONF_COMMAND_MAX_DELAY]))
+
+    if CONF_COMMAND_MAX_AGE in config:
+        cg.add(var.set_command_max_age(config[CONF_COMMAND_MAX_AGE]))
 
     if CONF_OUTSIDE_TEMPERATURE_OFFSET in config:
         cg.add(var.set_outside_temperature_offset(config[CONF_OUTSIDE_TEMPERATURE_OFFSET]))
@@ -121,11 +204,18 @@ async def to_code(config):
             conf = config[s]
             a_switch = await switch.new_switch(conf)
             await cg.register_component(a_switch, conf)
+            if config[CONF_PASSIVE]:
+                cg.add(a_switch.set_read_only(True))
             cg.add(getattr(var, f"set_{s}")(a_switch))
+            cg.add_define(SWITCH_DEFINES[s])
 
     if CONF_CURRENT_TEMPERATURE_SENSOR in config:
         sens = await cg.get_variable(config[CONF_CURRENT_TEMPERATURE_SENSOR])
         cg.add(var.set_current_temperature_sensor(sens))
+        cg.add_define("USE_PANASONIC_AC_CURRENT_TEMPERATURE_SENSOR")
+
+        if CONF_CURRENT_TEMPERATURE_MIN_INTERVAL in config:
+            cg.add(var.set_current_temperature_min_interval(config[CONF_CURRENT_TEMPERATURE_MIN_INTERVAL]))
 
     if CONF_CURRENT_TEMPERATURE_OFFSET in config:
         cg.add(var.set_current_temperature_offset(config[CONF_CURRENT_TEMPERATURE_OFFSET]))
@@ -133,3 +223,4 @@ async def to_code(config):
     if CONF_CURRENT_POWER_CONSUMPTION in config:
         sens = await sensor.new_sensor(config[CONF_CURRENT_POWER_CONSUMPTION])
         cg.add(var.set_current_power_consumption_sensor(sens))
+        cg.add_define("USE_PANASONIC_AC_POWER_CONSUMPTION")
@@ -2,39 +2,98 @@
 
 #include "esphome/core/log.h"
 
+#include <algorithm>
+#include <cinttypes>
+#include <cmath>
+
+#ifdef USE_ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
 namespace esphome {
 namespace panasonic_ac {
 
 static const char *const TAG = "panasonic_ac";
 
-climate::ClimateTraits PanasonicAC::traits() {
-  auto traits = climate::ClimateTraits();
+uint8_t PanasonicAC::instance_count_ = 0;
+
+climate::ClimateTraits PanasonicAC::traits() { return this->traits_; }
 
-  traits.add_feature_flags(
+size_t PanasonicAC::get_heap_size() const {
+  size_t size = this->rx_buffer_.capacity();
+
+  if (this->rx_queue_)
+    size += sizeof(*this->rx_queue_);
+#ifdef USE_PANASONIC_AC_PASSIVE
+  size += this->controller_buffer_.capacity();
+#endif
+#ifdef USE_PANASONIC_AC_FLIGHT_RECORDER
+  if (this->recorder_)
+    size += this->recorder_size_ * sizeof(RecordedPacket);
+#endif
+
+  return size;
+}
+
+/*
+ * Build the traits once, ESPHome asks for them on every control call and state publish
+ */
+void PanasonicAC::update_traits() {
+  this->traits_ = climate::ClimateTraits();
+
+  this->traits_.add_feature_flags(
       climate::CLIMATE_SUPPORTS_ACTION |
       climate::CLIMATE_SUPPORTS_CURRENT_TEMPERATURE
   );
 
-  traits.set_visual_min_temperature(MIN_TEMPERATURE);
-  traits.set_visual_max_temperature(MAX_TEMPERATURE);
-  traits.set_visual_temperature_step(TEMPERATURE_STEP);
+  this->traits_.set_visual_min_temperature(MIN_TEMPERATURE);
+  this->traits_.set_visual_max_temperature(MAX_TEMPERATURE);
+  this->traits_.set_visual_temperature_step(TEMPERATURE_STEP);
+
+  this->traits_.set_supported_modes({climate::CLIMATE_MODE_OFF, climate::CLIMATE_MODE_HEAT_COOL,
+                                     climate::CLIMATE_MODE_COOL, climate::CLIMATE_MODE_HEAT,
+                                     climate::CLIMATE_MODE_FAN_ONLY, climate::CLIMATE_MODE_DRY});
 
-  traits.set_supported_modes({climate::CLIMATE_MODE_OFF, climate::CLIMATE_MODE_HEAT_COOL, climate::CLIMATE_MODE_COOL,
-                              climate::CLIMATE_MODE_HEAT, climate::CLIMATE_MODE_FAN_ONLY, climate::CLIMATE_MODE_DRY});
+  if (!this->vertical_swing_supported_ && !this->horizontal_swing_supported_)
+    return;  // No swing at all, do not offer swing modes
 
-  traits.set_supported_swing_modes({climate::CLIMATE_SWING_OFF, climate::CLIMATE_SWING_BOTH,
-                                    climate::CLIMATE_SWING_VERTICAL, climate::CLIMATE_SWING_HORIZONTAL});
+  this->traits_.add_supported_swing_mode(climate::CLIMATE_SWING_OFF);
 
-  return traits;
+  if (this->vertical_swing_supported_ && this->horizontal_swing_supported_)
+    this->traits_.add_supported_swing_mode(climate::CLIMATE_SWING_BOTH);
+  if (this->vertical_swing_supported_)
+    this->traits_.add_supported_swing_mode(climate::CLIMATE_SWING_VERTICAL);
+  if (this->horizontal_swing_supported_)
+    this->traits_.add_supported_swing_mode(climate::CLIMATE_SWING_HORIZONTAL);
 }
 
 void PanasonicAC::setup() {
   // Initialize times
-  this->init_time_ = millis();
-  this->last_packet_sent_ = millis();
+  this->init_time_ = this->now_ms();
+  this->last_packet_sent_ = this->now_ms();
+
+  // Several ACs on one ESP start one after the other, so their handshakes and polls do not share the same deadlines
+  this->instance_index_ = instance_count_++;
+  this->init_time_ += this->instance_index_ * INSTANCE_STAGGER;
 
   this->set_supported_custom_fan_modes({"Automatic", "1", "2", "3", "4", "5"});
   this->set_supported_custom_presets({"Normal", "Powerful", "Quiet"});
+  this->update_traits();
+
+  this->rx_buffer_.reserve(BUFFER_SIZE);  // Allocated once instead of growing with the first packets
+#ifdef USE_PANASONIC_AC_PASSIVE
+  if (this->controller_uart_ != nullptr)
+    this->controller_buffer_.reserve(BUFFER_SIZE);
+#endif
+
+  if (this->rx_task_)
+    this->start_rx_task();
+
+#ifdef USE_PANASONIC_AC_FLIGHT_RECORDER
+  if (this->recorder_size_ > 0)
+    this->recorder_ = std::unique_ptr<RecordedPacket[]>(new RecordedPacket[this->recorder_size_]);
+#endif
 
   ESP_LOGI(TAG, "Panasonic AC component v%s starting...", VERSION);
 }
@@ -43,6 +102,160 @@ void PanasonicAC::loop() {
   read_data();  // Read data from UART (if there is any)
 }
 
+void PanasonicAC::dump_config() {
+  ESP_LOGCONFIG(TAG, "Panasonic AC v%s:", VERSION);
+  ESP_LOGCONFIG(TAG, "  Instance: %u, start offset: %u ms", this->instance_index_,
+                this->instance_index_ * INSTANCE_STAGGER);
+  ESP_LOGCONFIG(TAG, "  RAM: %u bytes, buffers: %u bytes", (unsigned) this->get_instance_size(),
+                (unsigned) this->get_heap_size());
+  ESP_LOGCONFIG(TAG, "  Command debounce: %" PRIu32 " ms", this->command_debounce_);
+  ESP_LOGCONFIG(TAG, "  Command max delay: %" PRIu32 " ms", this->command_max_delay_);
+  ESP_LOGCONFIG(TAG, "  Command max age: %" PRIu32 " ms", this->command_max_age_);
+  ESP_LOGCONFIG(TAG, "  Commands sent: %" PRIu32, this->commands_sent_);
+  ESP_LOGCONFIG(TAG, "  Changes coalesced: %" PRIu32, this->commands_coalesced_);
+#ifdef USE_PANASONIC_AC_PASSIVE
+  if (this->passive_)
+    ESP_LOGCONFIG(TAG, "  Passive: controller side %s", this->controller_uart_ != nullptr ? "tapped" : "not tapped");
+#endif
+}
+
+/*
+ * Command handling
+ */
+
+void PanasonicAC::set_clock(uint32_t (*clock)(), uint32_t (*clock_us)()) {
+  this->clock_ = clock;
+  this->clock_us_ = clock_us;
+}
+
+void PanasonicAC::set_command_debounce(uint32_t command_debounce) { this->command_debounce_ = command_debounce; }
+
+void PanasonicAC::set_command_max_delay(uint32_t command_max_delay) { this->command_max_delay_ = command_max_delay; }
+
+void PanasonicAC::set_command_max_age(uint32_t command_max_age) { this->command_max_age_ = command_max_age; }
+
+/*
+ * Called for every user change, delays the command until the input settles
+ */
+void PanasonicAC::schedule_command() {
+  uint32_t now = this->now_ms();
+
+  if (this->command_pending_) {
+    this->commands_coalesced_++;  // Merged into the pending command, saves a frame
+  } else {
+    this->command_pending_ = true;
+    this->first_command_change_ = now;
+  }
+
+  // Wait for further changes, but never longer than the maximum delay after the first change
+  uint32_t delay = command_delay(now, this->first_command_change_, this->command_debounce_, this->command_max_delay_);
+
+  this->arm_timer(Timer::Command, now, delay);
+}
+
+/*
+ * Returns true if the pending command should be sent now, keeping at least min_spacing to the last packet sent
+ */
+bool PanasonicAC::is_command_due(bool ready, uint32_t min_spacing) {
+  if (!this->is_timer_due(Timer::Command))
+    return false;
+
+  if (!ready) {
+    this->cancel_timer(Timer::Command);  // Keep the changes pending, they are sent by resume_command()
+    return false;
+  }
+
+  if (this->now_ms() - this->last_packet_sent_ < min_spacing) {
+    this->arm_timer(Timer::Command, this->last_packet_sent_, min_spacing);
+    return false;
+  }
+
+  this->cancel_timer(Timer::Command);
+  this->command_pending_ = false;
+
+  return true;
+}
+
+/*
+ * Returns true if a change made before the connection was ready is too old to be sent
+ *
+ * Every change has its own age, so a change made right before the connection got ready is kept even if older ones
+ * are dropped.
+ */
+bool PanasonicAC::is_change_expired(uint32_t changed) {
+  uint32_t age = this->now_ms() - changed;
+
+  if (age <= this->command_max_age_)
+    return false;
+
+  ESP_LOGW(TAG, "Dropping change made %" PRIu32 " ms ago", age);
+  return true;
+}
+
+/*
+ * Called by the drivers once the connection is ready and expired changes were dropped, sends the remaining ones
+ */
+void PanasonicAC::resume_command(bool has_changes) {
+  if (!this->command_pending_)
+    return;
+
+  if (!has_changes) {
+    this->command_pending_ = false;  // All changes expired
+    return;
+  }
+
+  ESP_LOGD(TAG, "Sending changes made before the connection was ready");
+  this->arm_timer(Timer::Command, this->now_ms(), 0);
+}
+
+/*
+ * Show the requested state right away, it gets corrected by the next poll or report if the AC did not accept it
+ */
+void PanasonicAC::publish_optimistic_state(const climate::ClimateCall &call) {
+  if (call.get_mode().has_value())
+    this->mode = *call.get_mode();
+
+  if (call.get_target_temperature().has_value())
+    this->target_temperature = *call.get_target_temperature();
+
+  if (call.has_custom_fan_mode())
+    this->set_custom_fan_mode_(call.get_custom_fan_mode().c_str());
+
+  if (call.get_swing_mode().has_value())
+    this->swing_mode = *call.get_swing_mode();
+
+  if (call.has_custom_preset())
+    this->set_custom_preset_(call.get_custom_preset().c_str());
+
+  this->publish_state();
+}
+
+/*
+ * Timer handling
+ */
+
+void PanasonicAC::arm_timer(Timer timer, uint32_t start, uint32_t delay) {
+  this->timers_.arm(timer, this->now_ms(), start, delay);
+}
+
+void PanasonicAC::cancel_timer(Timer timer) { this->timers_.cancel(timer); }
+
+bool PanasonicAC::is_timer_due(Timer timer) { return this->timers_.is_due(timer, this->now_ms()); }
+
+bool PanasonicAC::is_idle() {
+  if (this->rx_queue_ ? !this->rx_queue_->empty() : this->available())
+    return false;  // Packets or bytes are waiting to be read
+
+#ifdef USE_PANASONIC_AC_PASSIVE
+  if (this->controller_uart_ != nullptr && this->controller_uart_->available())
+    return false;
+#endif
+
+  return !this->timers_.any_due(this->now_ms());
+}
+
+uint32_t PanasonicAC::get_time_to_next_deadline() { return this->timers_.time_to_next(this->now_ms()); }
+
 void PanasonicAC::read_data() {
   while (available())  // Read while data is available
   {
@@ -55,10 +268,155 @@ void PanasonicAC::read_data() {
     this->read_byte(&c);  // Store in receive buffer
     this->rx_buffer_.push_back(c);
 
-    this->last_read_ = millis();  // Update lastRead timestamp
+    this->last_read_ = this->now_ms();  // Update lastRead timestamp
+    this->rx_timestamp_ = this->now_us();
+    this->arm_timer(Timer::Read, this->last_read_, READ_TIMEOUT);
+  }
+}
+
+/*
+ * Returns true if a complete packet is in rx_buffer_
+ */
+bool PanasonicAC::receive_packet() {
+  if (this->rx_queue_) {
+    const auto *frame = this->rx_queue_->peek();
+
+    uint32_t overruns = this->rx_overruns_.load(std::memory_order_relaxed);
+    if (overruns != this->rx_overruns_reported_) {
+      ESP_LOGW(TAG, "RX task dropped %" PRIu32 " packets", overruns - this->rx_overruns_reported_);
+      this->rx_overruns_reported_ = overruns;
+    }
+
+    if (frame == nullptr)
+      return false;
+
+    this->rx_buffer_.assign(frame->data, frame->data + frame->length);
+    this->rx_timestamp_ = frame->timestamp;
+    this->rx_queue_->pop();
+
+    return true;
+  }
+
+  read_data();  // Read data from UART (if there is any)
+
+  if (!this->is_timer_due(Timer::Read) || this->rx_buffer_.empty())
+    return false;  // Packet not complete yet
+
+  this->cancel_timer(Timer::Read);
+  return true;
+}
+
+#ifdef USE_PANASONIC_AC_PASSIVE
+/*
+ * Passive mode
+ */
+
+void PanasonicAC::set_passive(bool passive) { this->passive_ = passive; }
+
+void PanasonicAC::set_controller_uart(uart::UARTComponent *controller_uart) {
+  this->controller_uart_ = controller_uart;
+}
+
+/*
+ * Returns true if a complete packet sent by the official adapter is in controller_buffer_
+ */
+bool PanasonicAC::receive_controller_packet() {
+  if (this->controller_uart_ == nullptr)
+    return false;
+
+  while (this->controller_uart_->available()) {
+    uint8_t c;
+    this->controller_uart_->read_byte(&c);
+    this->controller_buffer_.push_back(c);
+
+    this->arm_timer(Timer::ControllerRead, this->now_ms(), READ_TIMEOUT);
+  }
+
+  if (!this->is_timer_due(Timer::ControllerRead) || this->controller_buffer_.empty())
+    return false;  // Packet not complete yet
+
+  this->cancel_timer(Timer::ControllerRead);
+  return true;
+}
+#endif
+
+/*
+ * RX task handling
+ */
+
+void PanasonicAC::set_rx_task(bool rx_task) { this->rx_task_ = rx_task; }
+
+void PanasonicAC::start_rx_task() {
+#ifdef USE_ESP32
+  this->rx_queue_ = std::make_unique<FrameQueue<RX_QUEUE_SIZE, BUFFER_SIZE>>();
+
+  auto task = [](void *arg) { static_cast<PanasonicAC *>(arg)->run_rx_task(); };
+
+#if CONFIG_FREERTOS_UNICORE
+  BaseType_t result = xTaskCreate(task, "panasonic_ac_rx", 2048, this, 5, nullptr);
+#else
+  // The loop runs on the app core, keep the RX task on the other one
+  BaseType_t result = xTaskCreatePinnedToCore(task, "panasonic_ac_rx", 2048, this, 5, nullptr, PRO_CPU_NUM);
+#endif
+
+  if (result != pdPASS) {
+    ESP_LOGE(TAG, "Failed to start RX task, falling back to reading in the loop");
+    this->rx_queue_.reset();
+  }
+#else
+  ESP_LOGW(TAG, "RX task is only supported on the ESP32");
+#endif
+}
+
+/*
+ * Runs in the RX task, splits the incoming bytes into packets using the same read timeout as the loop
+ */
+void PanasonicAC::run_rx_task() {
+#ifdef USE_ESP32
+  ReceivedFrame<BUFFER_SIZE> *frame = nullptr;
+  size_t length = 0;
+  uint32_t last_read = 0;
+  uint32_t last_read_us = 0;
+
+  while (true) {
+    bool received = false;
+    uint8_t c;
+
+    while (this->available() && this->read_byte(&c)) {
+      // A slot is only taken at the start of a packet, a packet that started while the queue was full is dropped as a
+      // whole even if a slot frees up while it is received
+      if (length == 0)
+        frame = this->rx_queue_->acquire();
+
+      if (frame != nullptr && length < BUFFER_SIZE)
+        frame->data[length] = c;
+
+      length++;  // Keep counting so oversized or dropped packets are detected
+      received = true;
+    }
+
+    if (received) {
+      last_read = this->now_ms();
+      last_read_us = this->now_us();
+    } else if (length > 0 && this->now_ms() - last_read > READ_TIMEOUT) {
+      if (frame != nullptr && length <= BUFFER_SIZE) {
+        frame->length = length;
+        frame->timestamp = last_read_us;
+        this->rx_queue_->commit();
+        frame = nullptr;
+      } else {
+        this->rx_overruns_.fetch_add(1, std::memory_order_relaxed);  // Queue was full or packet too long
+      }
+
+      length = 0;
+    }
+
+    vTaskDelay(1);
   }
+#endif
 }
 
+#ifdef USE_PANASONIC_AC_OUTSIDE_TEMPERATURE
 void PanasonicAC::update_outside_temperature(int8_t temperature) {
   ESP_LOGV(TAG, "Received outside temperature %d", temperature);
   temperature += this->outside_temperature_offset_;
@@ -74,6 +432,7 @@ void PanasonicAC::update_outside_temperature(int8_t temperature) {
     ESP_LOGV(TAG, "Outside temperature incl. offset: %d", temperature);
   }
 }
+#endif
 
 void PanasonicAC::update_current_temperature(int8_t temperature) {
   ESP_LOGV(TAG, "Received current temperature %d", temperature);
@@ -104,53 +463,72 @@ void PanasonicAC::update_target_temperature(uint8_t raw_value) {
   ESP_LOGV(TAG, "Target temperature incl. offset: %.2f", temperature);
 }
 
+/*
+ * Raw value of a requested target temperature, without the offset and rounded to the nearest TEMPERATURE_STEP
+ */
+uint8_t PanasonicAC::encode_target_temperature(float temperature) {
+  return (uint8_t) lroundf((temperature - this->current_temperature_offset_) / TEMPERATURE_STEP);
+}
+
+#ifdef USE_PANASONIC_AC_HORIZONTAL_SWING
 void PanasonicAC::update_swing_horizontal(const StringRef &swing) {
   if (this->horizontal_swing_select_ != nullptr) {
-    this->horizontal_swing_state_ = this->horizontal_swing_select_->index_of(swing).value_or(~0UL);
+    this->horizontal_swing_state_ = this->horizontal_swing_select_->index_of(swing).value_or(SWING_STATE_UNKNOWN);
 
-    if (this->horizontal_swing_state_ != this->horizontal_swing_select_->active_index().value_or(~0UL)) {
+    if (this->horizontal_swing_state_ != this->horizontal_swing_select_->active_index().value_or(SWING_STATE_UNKNOWN)) {
       this->horizontal_swing_select_->publish_state(this->horizontal_swing_state_);  // Set current horizontal swing position
     }
   }
 }
+#endif
 
+#ifdef USE_PANASONIC_AC_VERTICAL_SWING
 void PanasonicAC::update_swing_vertical(const StringRef &swing) {
   if (this->vertical_swing_select_ != nullptr) {
-    this->vertical_swing_state_ = this->vertical_swing_select_->index_of(swing).value_or(~0UL);
+    this->vertical_swing_state_ = this->vertical_swing_select_->index_of(swing).value_or(SWING_STATE_UNKNOWN);
 
-    if (this->vertical_swing_state_ != this->vertical_swing_select_->active_index().value_or(~0UL)) {
+    if (this->vertical_swing_state_ != this->vertical_swing_select_->active_index().value_or(SWING_STATE_UNKNOWN)) {
       this->vertical_swing_select_->publish_state(this->vertical_swing_state_);  // Set current vertical swing position
     }
   }
 }
+#endif
 
+#ifdef USE_PANASONIC_AC_NANOEX
 void PanasonicAC::update_nanoex(bool nanoex) {
   if (this->nanoex_switch_ != nullptr) {
     this->nanoex_state_ = nanoex;
     this->nanoex_switch_->publish_state(this->nanoex_state_);
   }
 }
+#endif
 
+#ifdef USE_PANASONIC_AC_ECO
 void PanasonicAC::update_eco(bool eco) {
   if (this->eco_switch_ != nullptr) {
     this->eco_state_ = eco;
     this->eco_switch_->publish_state(this->eco_state_);
   }
 }
+#endif
 
+#ifdef USE_PANASONIC_AC_ECONAVI
 void PanasonicAC::update_econavi(bool econavi) {
   if (this->econavi_switch_ != nullptr) {
     this->econavi_state_ = econavi;
     this->econavi_switch_->publish_state(this->econavi_state_);
   }
 }
+#endif
 
+#ifdef USE_PANASONIC_AC_MILD_DRY
 void PanasonicAC::update_mild_dry(bool mild_dry) {
   if (this->mild_dry_switch_ != nullptr) {
     this->mild_dry_state_ = mild_dry;
     this->mild_dry_switch_->publish_state(this->mild_dry_state_);
   }
 }
+#endif
 
 climate::ClimateAction PanasonicAC::determine_action() {
   if (this->mode == climate::CLIMATE_MODE_OFF) {
@@ -170,34 +548,42 @@ climate::ClimateAction PanasonicAC::determine_action() {
   }
 }
 
+#ifdef USE_PANASONIC_AC_POWER_CONSUMPTION
 void PanasonicAC::update_current_power_consumption(int16_t power) {
   if (this->current_power_consumption_sensor_ != nullptr && this->current_power_consumption_sensor_->state != power) {
     this->current_power_consumption_sensor_->publish_state(
         power);  // Set current power consumption
   }
 }
+#endif
 
+#ifdef USE_PANASONIC_AC_DEFROST
 void PanasonicAC::update_defrost(bool defrost) {
   if (this->defrost_sensor_ != nullptr) {
     this->defrost_sensor_->publish_state(defrost);
   }
 }
+#endif
 
 /*
  * Sensor handling
  */
 
+#ifdef USE_PANASONIC_AC_OUTSIDE_TEMPERATURE
 void PanasonicAC::set_outside_temperature_sensor(sensor::Sensor *outside_temperature_sensor) {
   this->outside_temperature_sensor_ = outside_temperature_sensor;
 }
+#endif
 
 void PanasonicAC::set_outside_temperature_offset(int8_t outside_temperature_offset) {
   ESP_LOGV(TAG, "Outside temperature offset %d", outside_temperature_offset);
   this->outside_temperature_offset_ = outside_temperature_offset;
 
+#ifdef USE_PANASONIC_AC_OUTSIDE_TEMPERATURE
   if (this->outside_temperature_sensor_) {
-    ESP_LOGV(TAG, "Corrected outside temperature: %d", this->outside_temperature_sensor_->state + outside_temperature_offset);
+    ESP_LOGV(TAG, "Corrected outside temperature: %.1f", this->outside_temperature_sensor_->state + outside_temperature_offset);
   }
+#endif
 }
 
 void PanasonicAC::set_current_temperature_offset(int8_t current_temperature_offset)
@@ -205,94 +591,152 @@ void PanasonicAC::set_current_temperature_offset(int8_t current_temperature_offs
   ESP_LOGV(TAG, "Current temperature offset %d", current_temperature_offset);
   this->current_temperature_offset_ = current_temperature_offset;
 
+#ifdef USE_PANASONIC_AC_CURRENT_TEMPERATURE_SENSOR
   if (this->current_temperature_sensor_) {
-    ESP_LOGV(TAG, "Corrected current temperature: %d", this->current_temperature_sensor_->state + current_temperature_offset);
+    ESP_LOGV(TAG, "Corrected current temperature: %.1f", this->current_temperature_sensor_->state + current_temperature_offset);
   }
+#endif
 }
 
+#ifdef USE_PANASONIC_AC_CURRENT_TEMPERATURE_SENSOR
 void PanasonicAC::set_current_temperature_sensor(sensor::Sensor *current_temperature_sensor)
 {
   this->current_temperature_sensor_ = current_temperature_sensor;
   this->current_temperature_sensor_->add_on_state_callback([this](float state)
                                                            {
-                                                             this->current_temperature = state + this->current_temperature_offset_;
-                                                             this->publish_state();
+                                                             // Only remember the value, publishing is rate limited in the loop
+                                                             this->pending_current_temperature_ = state + this->current_temperature_offset_;
+                                                             this->arm_timer(Timer::CurrentTemperature, this->last_current_temperature_publish_,
+                                                                             this->current_temperature_min_interval_);
                                                            });
 }
 
-void PanasonicAC::set_vertical_swing_select(select::Select *vertical_swing_select) {
-  this->vertical_swing_select_ = vertical_swing_select;
-  this->vertical_swing_select_->add_on_state_callback([this](size_t index) {
-    if (index == this->vertical_swing_state_)
-      return;
-    this->on_vertical_swing_change(this->vertical_swing_select_->current_option());
-  });
+void PanasonicAC::set_current_temperature_min_interval(uint32_t current_temperature_min_interval) {
+  this->current_temperature_min_interval_ = current_temperature_min_interval;
 }
 
-void PanasonicAC::set_horizontal_swing_select(select::Select *horizontal_swing_select) {
-  this->horizontal_swing_select_ = horizontal_swing_select;
-  this->horizontal_swing_select_->add_on_state_callback([this](size_t index) {
-    if (index == this->horizontal_swing_state_)
-      return;
-    this->on_horizontal_swing_change(this->horizontal_swing_select_->current_option());
-  });
-}
+void PanasonicAC::handle_current_temperature_sensor() {
+  if (!this->is_timer_due(Timer::CurrentTemperature))
+    return;  // Keep the latest value until the interval has passed, bursts are merged into one publish
 
-void PanasonicAC::set_nanoex_switch(switch_::Switch *nanoex_switch) {
-  this->nanoex_switch_ = nanoex_switch;
-  this->nanoex_switch_->add_on_state_callback([this](bool state) {
-    if (state == this->nanoex_state_)
-      return;
-    this->on_nanoex_change(state);
-  });
-}
+  this->cancel_timer(Timer::CurrentTemperature);
 
-void PanasonicAC::set_eco_switch(switch_::Switch *eco_switch) {
-  this->eco_switch_ = eco_switch;
-  this->eco_switch_->add_on_state_callback([this](bool state) {
-    if (state == this->eco_state_)
-      return;
-    this->on_eco_change(state);
-  });
-}
+  if (std::isnan(this->pending_current_temperature_))
+    return;  // Nothing new from the external sensor
 
-void PanasonicAC::set_econavi_switch(switch_::Switch *econavi_switch) {
-  this->econavi_switch_ = econavi_switch;
-  this->econavi_switch_->add_on_state_callback([this](bool state) {
-    if (state == this->econavi_state_)
-      return;
-    this->on_econavi_change(state);
-  });
-}
+  if (this->pending_current_temperature_ == this->current_temperature) {
+    this->pending_current_temperature_ = NAN;  // Unchanged, drop it without publishing
+    return;
+  }
+
+  ESP_LOGV(TAG, "Publishing external current temperature %.2f", this->pending_current_temperature_);
 
-void PanasonicAC::set_mild_dry_switch(switch_::Switch *mild_dry_switch) {
-  this->mild_dry_switch_ = mild_dry_switch;
-  this->mild_dry_switch_->add_on_state_callback([this](bool state) {
-    if (state == this->mild_dry_state_)
-      return;
-    this->on_mild_dry_change(state);
-  });
+  this->current_temperature = this->pending_current_temperature_;
+  this->pending_current_temperature_ = NAN;
+  this->last_current_temperature_publish_ = this->now_ms();
+
+  this->publish_state();
 }
+#endif
 
+#ifdef USE_PANASONIC_AC_POWER_CONSUMPTION
 void PanasonicAC::set_current_power_consumption_sensor(sensor::Sensor *current_power_consumption_sensor) {
   this->current_power_consumption_sensor_ = current_power_consumption_sensor;
 }
+#endif
 
+#ifdef USE_PANASONIC_AC_DEFROST
 void PanasonicAC::set_defrost_sensor(binary_sensor::BinarySensor *defrost_sensor) {
   this->defrost_sensor_ = defrost_sensor;
 }
+#endif
 
 /*
  * Debugging
  */
 
-void PanasonicAC::log_packet(std::vector<uint8_t> data, bool outgoing) {
-  if (outgoing) {
-    ESP_LOGV(TAG, "TX: %s", format_hex_pretty(data).c_str());
-  } else {
-    ESP_LOGV(TAG, "RX: %s", format_hex_pretty(data).c_str());
+#if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_VERBOSE || defined(USE_PANASONIC_AC_FLIGHT_RECORDER)
+void PanasonicAC::trace_packet(const uint8_t *data, size_t length, bool outgoing) {
+#ifdef USE_PANASONIC_AC_FLIGHT_RECORDER
+  this->record_packet(data, length, outgoing);
+#endif
+
+#if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_VERBOSE
+  // Format on the stack, packets are never longer than BUFFER_SIZE
+  static const char *const HEX_CHARS = "0123456789ABCDEF";
+  char hex[BUFFER_SIZE * 3];
+  size_t pos = 0;
+
+  length = std::min(length, (size_t) BUFFER_SIZE);
+
+  for (size_t i = 0; i < length; i++) {
+    if (i > 0)
+      hex[pos++] = '.';
+
+    hex[pos++] = HEX_CHARS[data[i] >> 4];
+    hex[pos++] = HEX_CHARS[data[i] & 0x0F];
+  }
+
+  hex[pos] = '\0';
+
+  ESP_LOGV(TAG, "%s: %s (%u)", outgoing ? "TX" : "RX", hex, (unsigned) length);
+#endif
+}
+#endif
+
+#ifdef USE_PANASONIC_AC_FLIGHT_RECORDER
+void PanasonicAC::set_flight_recorder_size(uint8_t flight_recorder_size) {
+  this->recorder_size_ = flight_recorder_size;
+}
+
+void PanasonicAC::record_packet(const uint8_t *data, size_t length, bool outgoing) {
+  if (!this->recorder_)
+    return;
+
+  RecordedPacket &packet = this->recorder_[this->recorder_index_];
+
+  packet.timestamp = outgoing ? this->now_us() : this->rx_timestamp_;
+  packet.outgoing = outgoing;
+  packet.length = std::min(length, (size_t) BUFFER_SIZE);
+  std::copy(data, data + packet.length, packet.data);
+
+  this->recorder_index_ = (this->recorder_index_ + 1) % this->recorder_size_;
+
+  if (this->recorder_count_ < this->recorder_size_)
+    this->recorder_count_++;
+}
+
+/*
+ * Logs the recorded packets from oldest to newest, one base64 line per packet
+ *
+ * Each line decodes to: direction (0 = RX, 1 = TX), timestamp in microseconds (4 bytes, little endian), length, data
+ */
+void PanasonicAC::dump_flight_recorder() {
+  if (!this->recorder_) {
+    ESP_LOGW(TAG, "Flight recorder is not enabled");
+    return;
+  }
+
+  ESP_LOGI(TAG, "Flight recorder: %u packets", this->recorder_count_);
+
+  uint8_t start = (this->recorder_index_ + this->recorder_size_ - this->recorder_count_) % this->recorder_size_;
+  uint8_t buffer[6 + BUFFER_SIZE];
+
+  for (uint8_t i = 0; i < this->recorder_count_; i++) {
+    const RecordedPacket &packet = this->recorder_[(start + i) % this->recorder_size_];
+
+    buffer[0] = packet.outgoing ? 1 : 0;
+    buffer[1] = packet.timestamp >> 0;
+    buffer[2] = packet.timestamp >> 8;
+    buffer[3] = packet.timestamp >> 16;
+    buffer[4] = packet.timestamp >> 24;
+    buffer[5] = packet.length;
+    std::copy(packet.data, packet.data + packet.length, buffer + 6);
+
+    ESP_LOGI(TAG, "FR: %s", base64_encode(buffer, 6 + packet.length).c_str());
   }
 }
+#endif
 
 }  // namespace panasonic_ac
 }  // namespace esphome
@@ -7,6 +7,15 @@
 #include "esphome/components/binary_sensor/binary_sensor.h"
 #include "esphome/components/uart/uart.h"
 #include "esphome/core/component.h"
+#include "esphome/core/defines.h"
+#include "esphome/core/log.h"
+#include "esppac_codec.h"
+#include "esppac_frame_queue.h"
+#include "esppac_frame_view.h"
+#include "esppac_scheduler.h"
+
+#include <cmath>
+#include <memory>
 
 namespace esphome {
 
@@ -14,8 +23,11 @@ namespace panasonic_ac {
 
 static const char *const VERSION = "2.5.1";
 
-static const uint8_t BUFFER_SIZE = 128;  // The maximum size of a single packet (both receive and transmit)
-static const uint8_t READ_TIMEOUT = 20;  // The maximum time to wait before considering a packet complete
+static const uint8_t BUFFER_SIZE = 128;           // The maximum size of a single packet (both receive and transmit)
+static const uint8_t READ_TIMEOUT = 20;           // The maximum time to wait before considering a packet complete
+static const uint8_t RX_QUEUE_SIZE = 4;           // The number of complete packets the RX task can hold for the loop
+static const uint16_t INSTANCE_STAGGER = 1000;    // Start offset between several ACs on one ESP so they do not poll at once
+static const uint8_t SWING_STATE_UNKNOWN = 0xFF;  // Swing select index used if the position has no option
 
 static const uint8_t MIN_TEMPERATURE = 16;     // Minimum temperature as reported by Panasonic app
 static const uint8_t MAX_TEMPERATURE = 30;     // Maximum temperature as supported by Panasonic app
@@ -26,90 +38,365 @@ static const uint8_t TEMPERATURE_THRESHOLD =
 
 enum class CommandType { Normal, Response, Resend };
 
+// Protocol deadlines, all of them are tracked in a single table so the loop can skip work until the next one is due
+enum class Timer : uint8_t {
+  Read,                // Incoming packet is considered complete
+  Poll,                // Next poll
+  Command,             // Next queued command
+  Resend,              // Resend the last packet if no response was received
+  Init,                // Next initialization step
+  InitFail,            // Initialization is considered failed
+  CurrentTemperature,  // Publish the value of the external current temperature sensor
+  Transmit,            // Queued response can be sent
+  ControllerRead,      // Incoming packet from the controller side is considered complete (passive mode)
+  Count
+};
+
+#ifdef USE_PANASONIC_AC_FLIGHT_RECORDER
+struct RecordedPacket {
+  uint32_t timestamp;  // Time in microseconds at which the packet was received or sent
+  uint8_t length;      // Number of valid bytes in data
+  bool outgoing;       // True if the packet was sent by us
+  uint8_t data[BUFFER_SIZE];
+};
+#endif
+
 enum class ACType {
   DNSKP11,  // New module (via CN-WLAN)
   CZTACG1   // Old module (via CN-CNT)
 };
 
+class PanasonicACAuto;
+
 class PanasonicAC : public Component, public uart::UARTDevice, public climate::Climate {
+  friend class PanasonicACAuto;  // Delegates to a driver it created
+
  public:
+#ifdef USE_PANASONIC_AC_OUTSIDE_TEMPERATURE
   void set_outside_temperature_sensor(sensor::Sensor *outside_temperature_sensor);
+#endif
   void set_outside_temperature_offset(int8_t outside_temperature_offset);
-  void set_vertical_swing_select(select::Select *vertical_swing_select);
-  void set_horizontal_swing_select(select::Select *horizontal_swing_select);
-  void set_nanoex_switch(switch_::Switch *nanoex_switch);
-  void set_eco_switch(switch_::Switch *eco_switch);
-  void set_econavi_switch(switch_::Switch *econavi_switch);
-  void set_mild_dry_switch(switch_::Switch *mild_dry_switch);
+#ifdef USE_PANASONIC_AC_POWER_CONSUMPTION
   void set_current_power_consumption_sensor(sensor::Sensor *current_power_consumption_sensor);
+#endif
+#ifdef USE_PANASONIC_AC_DEFROST
   void set_defrost_sensor(binary_sensor::BinarySensor *defrost_sensor);
+#endif
 
+#ifdef USE_PANASONIC_AC_CURRENT_TEMPERATURE_SENSOR
   void set_current_temperature_sensor(sensor::Sensor *current_temperature_sensor);
+  void set_current_temperature_min_interval(uint32_t current_temperature_min_interval);
+#endif
   void set_current_temperature_offset(int8_t current_temperature_offset);
 
+  void set_rx_task(bool rx_task);
+
+  void set_command_debounce(uint32_t command_debounce);
+  void set_command_max_delay(uint32_t command_max_delay);
+  void set_command_max_age(uint32_t command_max_age);
+
+#ifdef USE_PANASONIC_AC_PASSIVE
+  void set_passive(bool passive);
+  void set_controller_uart(uart::UARTComponent *controller_uart);
+#endif
+
+#ifdef USE_PANASONIC_AC_FLIGHT_RECORDER
+  void set_flight_recorder_size(uint8_t flight_recorder_size);
+  void dump_flight_recorder();
+#endif
+
   void setup() override;
   void loop() override;
+  void dump_config() override;
+
+  // Replaces millis() and micros() for all protocol timing and packet timestamps, e.g. to fast-forward a simulation
+  void set_clock(uint32_t (*clock)(), uint32_t (*clock_us)() = &micros);
+
+  uint32_t get_time_to_next_deadline();  // Time in ms until the loop has work to do, can be used as a wake-up hint
 
  protected:
+  // Entities only exist if at least one configured AC uses them, see the feature defines emitted by climate.py
+#ifdef USE_PANASONIC_AC_OUTSIDE_TEMPERATURE
   sensor::Sensor *outside_temperature_sensor_ = nullptr;        // Sensor to store outside temperature from queries
+#endif
+#ifdef USE_PANASONIC_AC_VERTICAL_SWING
   select::Select *vertical_swing_select_ = nullptr;             // Select to store manual position of vertical swing
+#endif
+#ifdef USE_PANASONIC_AC_HORIZONTAL_SWING
   select::Select *horizontal_swing_select_ = nullptr;           // Select to store manual position of horizontal swing
+#endif
+#ifdef USE_PANASONIC_AC_NANOEX
   switch_::Switch *nanoex_switch_ = nullptr;                    // Switch to toggle nanoeX on/off
+#endif
+#ifdef USE_PANASONIC_AC_ECO
   switch_::Switch *eco_switch_ = nullptr;                       // Switch to toggle eco mode on/off
+#endif
+#ifdef USE_PANASONIC_AC_ECONAVI
   switch_::Switch *econavi_switch_ = nullptr;                   // Switch to toggle econavi mode on/off
+#endif
+#ifdef USE_PANASONIC_AC_MILD_DRY
   switch_::Switch *mild_dry_switch_ = nullptr;                  // Switch to toggle mild dry mode on/off
+#endif
+#ifdef USE_PANASONIC_AC_CURRENT_TEMPERATURE_SENSOR
   sensor::Sensor *current_temperature_sensor_ = nullptr;        // Sensor to use for current temperature where AC does not report
+#endif
+#ifdef USE_PANASONIC_AC_POWER_CONSUMPTION
   sensor::Sensor *current_power_consumption_sensor_ = nullptr;  // Sensor to store current power consumption from queries
+#endif
+#ifdef USE_PANASONIC_AC_DEFROST
   binary_sensor::BinarySensor *defrost_sensor_ = nullptr;       // Sensor to store defrost status
+#endif
 
-  size_t vertical_swing_state_;
-  size_t horizontal_swing_state_;
+  climate::ClimateTraits traits_;  // Built by update_traits(), returned by traits()
 
-  int8_t current_temperature_offset_ = 0;  // current temperature offset to compensate internal sensor values
-  int8_t outside_temperature_offset_ = 0;  // outside temperature offset to compensate internal sensor values
-  bool nanoex_state_ = false;    // Stores the state of nanoex to prevent duplicate packets
-  bool eco_state_ = false;       // Stores the state of eco to prevent duplicate packets
-  bool econavi_state_ = false;       // Stores the state of econavi to prevent duplicate packets
-  bool mild_dry_state_ = false;  // Stores the state of mild dry to prevent duplicate packets
+  // Small fields are kept together so they pack without padding, every AC on the ESP carries a copy
+  uint8_t instance_index_ = 0;                            // Position of this AC among all configured ones
+  uint8_t vertical_swing_state_ = SWING_STATE_UNKNOWN;    // Index of the vertical swing option reported by the AC
+  uint8_t horizontal_swing_state_ = SWING_STATE_UNKNOWN;  // Index of the horizontal swing option reported by the AC
+  int8_t current_temperature_offset_ = 0;                 // current temperature offset to compensate internal sensor values
+  int8_t outside_temperature_offset_ = 0;                 // outside temperature offset to compensate internal sensor values
+  bool vertical_swing_supported_ = true;                  // Set to false if the AC reports that it has no vertical swing
+  bool horizontal_swing_supported_ = true;                // Set to false if the AC reports that it has no horizontal swing
+  bool nanoex_state_ = false;                             // Stores the state of nanoex to prevent duplicate packets
+  bool eco_state_ = false;                                // Stores the state of eco to prevent duplicate packets
+  bool econavi_state_ = false;                            // Stores the state of econavi to prevent duplicate packets
+  bool mild_dry_state_ = false;                           // Stores the state of mild dry to prevent duplicate packets
+  bool waiting_for_response_ = false;                     // Set to true if we are waiting for a response
+  bool command_pending_ = false;                          // Set to true if changes are waiting to be sent
+  bool rx_task_ = false;                                  // Receive packets in a dedicated task
 
-  bool waiting_for_response_ = false;  // Set to true if we are waiting for a response
+#ifdef USE_PANASONIC_AC_CURRENT_TEMPERATURE_SENSOR
+  float pending_current_temperature_ = NAN;           // Latest external sensor value that has not been published yet
+  uint32_t current_temperature_min_interval_ = 5000;  // Minimum time between two publishes caused by the external sensor
+  uint32_t last_current_temperature_publish_ = 0;     // Stores the time at which the external sensor value was published
+#endif
+  uint32_t command_debounce_ = 250;    // Time to wait for further changes before sending a command
+  uint32_t command_max_delay_ = 1000;  // Maximum time a command is delayed by further changes
+  uint32_t command_max_age_ = 60000;   // Maximum age of changes made before the connection is ready
+  uint32_t first_command_change_ = 0;  // Stores the time of the first change of the pending command
+  uint32_t commands_sent_ = 0;         // Number of commands sent
+  uint32_t commands_coalesced_ = 0;    // Number of changes merged into another command instead of being sent
 
   // uint8_t receive_buffer_index = 0;     // Current position of the receive buffer
   // uint8_t receive_buffer[BUFFER_SIZE];  // Stores the packet currently being received
 
   std::vector<uint8_t> rx_buffer_;
+  uint32_t rx_timestamp_ = 0;  // Time in microseconds at which the last byte of rx_buffer_ was received
+
+  std::unique_ptr<FrameQueue<RX_QUEUE_SIZE, BUFFER_SIZE>> rx_queue_;  // Packets handed from the RX task to the loop
+  std::atomic<uint32_t> rx_overruns_{0};                                 // Packets dropped by the RX task
+  uint32_t rx_overruns_reported_ = 0;                                    // Dropped packets already logged
+
+#ifdef USE_PANASONIC_AC_PASSIVE
+  bool passive_ = false;                              // Only listen, never transmit
+  uart::UARTComponent *controller_uart_ = nullptr;    // Optional tap of the line from the official adapter to the AC
+  std::vector<uint8_t> controller_buffer_;            // Stores the packet currently being received from the adapter
+#endif
+
+#ifdef USE_PANASONIC_AC_FLIGHT_RECORDER
+  std::unique_ptr<RecordedPacket[]> recorder_;  // Ring of the last sent and received packets
+  uint8_t recorder_size_ = 0;                   // Number of packets the ring can hold
+  uint8_t recorder_index_ = 0;                  // Next position to write to
+  uint8_t recorder_count_ = 0;                  // Number of packets stored
+#endif
+
+  uint32_t init_time_;                 // Stores the current time
+  uint32_t last_read_;                 // Stores the time at which the last read was done
+  uint32_t last_packet_sent_;          // Stores the time at which the last packet was sent
+  uint32_t last_packet_received_ = 0;  // Stores the time at which the last packet was received
+
+  uint32_t (*clock_)() = &millis;     // Time source in milliseconds, see set_clock()
+  uint32_t (*clock_us_)() = &micros;  // Time source in microseconds for packet timestamps
+
+  static uint8_t instance_count_;  // Number of ACs set up so far, used to stagger their start
 
-  uint32_t init_time_;             // Stores the current time
-  uint32_t last_read_;             // Stores the time at which the last read was done
-  uint32_t last_packet_sent_;      // Stores the time at which the last packet was sent
-  uint32_t last_packet_received_;  // Stores the time at which the last packet was received
+  TimerTable<Timer, (size_t) Timer::Count> timers_;  // Deadlines of all protocol timers
 
   climate::ClimateTraits traits() override;
+  virtual size_t get_instance_size() const { return sizeof(PanasonicAC); }
+  size_t get_heap_size() const;  // Buffers this AC allocated, on top of get_instance_size()
+  void update_traits();
 
   void read_data();
+  bool receive_packet();
 
+  void start_rx_task();
+  void run_rx_task();
+
+#ifdef USE_PANASONIC_AC_PASSIVE
+  bool is_passive() const { return this->passive_; }
+  bool receive_controller_packet();
+#else
+  bool is_passive() const { return false; }
+#endif
+
+  uint32_t now_ms() { return this->clock_(); }
+  uint32_t now_us() { return this->clock_us_(); }
+
+  void arm_timer(Timer timer, uint32_t start, uint32_t delay);
+  void cancel_timer(Timer timer);
+  bool is_timer_due(Timer timer);
+  bool is_idle();
+
+  // Updates of features that are not configured anywhere compile to nothing, decoding them is skipped as well
+#ifdef USE_PANASONIC_AC_OUTSIDE_TEMPERATURE
   void update_outside_temperature(int8_t temperature);
+#else
+  void update_outside_temperature(int8_t temperature) {}
+#endif
   void update_current_temperature(int8_t temperature);
   void update_target_temperature(uint8_t raw_value);
+  uint8_t encode_target_temperature(float temperature);  // Inverse of update_target_temperature()
+#ifdef USE_PANASONIC_AC_HORIZONTAL_SWING
   void update_swing_horizontal(const StringRef &swing);
+#else
+  void update_swing_horizontal(const StringRef &swing) {}
+#endif
+#ifdef USE_PANASONIC_AC_VERTICAL_SWING
   void update_swing_vertical(const StringRef &swing);
+#else
+  void update_swing_vertical(const StringRef &swing) {}
+#endif
+#ifdef USE_PANASONIC_AC_NANOEX
   void update_nanoex(bool nanoex);
+#else
+  void update_nanoex(bool nanoex) {}
+#endif
+#ifdef USE_PANASONIC_AC_ECO
   void update_eco(bool eco);
+#else
+  void update_eco(bool eco) {}
+#endif
+#ifdef USE_PANASONIC_AC_ECONAVI
   void update_econavi(bool econavi);
+#else
+  void update_econavi(bool econavi) {}
+#endif
+#ifdef USE_PANASONIC_AC_MILD_DRY
   void update_mild_dry(bool mild_dry);
+#else
+  void update_mild_dry(bool mild_dry) {}
+#endif
+#ifdef USE_PANASONIC_AC_POWER_CONSUMPTION
   void update_current_power_consumption(int16_t power);
+#else
+  void update_current_power_consumption(int16_t power) {}
+#endif
+#ifdef USE_PANASONIC_AC_DEFROST
   void update_defrost(bool defrost);
+#else
+  void update_defrost(bool defrost) {}
+#endif
+
+#ifdef USE_PANASONIC_AC_CURRENT_TEMPERATURE_SENSOR
+  void handle_current_temperature_sensor();
+#else
+  void handle_current_temperature_sensor() {}
+#endif
 
-  virtual void on_horizontal_swing_change(const StringRef &swing) = 0;
-  virtual void on_vertical_swing_change(const StringRef &swing) = 0;
-  virtual void on_nanoex_change(bool nanoex) = 0;
-  virtual void on_eco_change(bool eco) = 0;
-  virtual void on_econavi_change(bool econavi) = 0;
-  virtual void on_mild_dry_change(bool mild_dry) = 0;
+  void schedule_command();
+  bool is_command_due(bool ready, uint32_t min_spacing);
+  bool is_change_expired(uint32_t changed);
+  void resume_command(bool has_changes);
+  void publish_optimistic_state(const climate::ClimateCall &call);
 
   climate::ClimateAction determine_action();
 
-  void log_packet(std::vector<uint8_t> data, bool outgoing = false);
+  // Compiles to nothing unless verbose logging or the flight recorder is enabled
+  void log_packet(const std::vector<uint8_t> &data, bool outgoing = false) {
+#if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_VERBOSE || defined(USE_PANASONIC_AC_FLIGHT_RECORDER)
+    this->trace_packet(data.data(), data.size(), outgoing);
+#endif
+  }
+
+#if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_VERBOSE || defined(USE_PANASONIC_AC_FLIGHT_RECORDER)
+  void trace_packet(const uint8_t *data, size_t length, bool outgoing);
+#endif
+
+#ifdef USE_PANASONIC_AC_FLIGHT_RECORDER
+  void record_packet(const uint8_t *data, size_t length, bool outgoing);
+#endif
+};
+
+/*
+ * Entity setters shared by the protocol drivers
+ *
+ * The callbacks call the on_*_change() hooks of Derived directly, so they are resolved at compile time and a setter
+ * (and the hook behind it) is only compiled if the driver supports the entity. In passive mode the entities are read
+ * only, so changes never reach the callbacks.
+ */
+template<typename Derived> class PanasonicACDriver : public PanasonicAC {
+ public:
+#ifdef USE_PANASONIC_AC_VERTICAL_SWING
+  void set_vertical_swing_select(select::Select *vertical_swing_select) {
+    this->vertical_swing_select_ = vertical_swing_select;
+    this->vertical_swing_select_->add_on_state_callback([this](size_t index) {
+      if (index == this->vertical_swing_state_)
+        return;
+      this->derived()->on_vertical_swing_change(this->vertical_swing_select_->current_option());
+    });
+  }
+#endif
+
+#ifdef USE_PANASONIC_AC_HORIZONTAL_SWING
+  void set_horizontal_swing_select(select::Select *horizontal_swing_select) {
+    this->horizontal_swing_select_ = horizontal_swing_select;
+    this->horizontal_swing_select_->add_on_state_callback([this](size_t index) {
+      if (index == this->horizontal_swing_state_)
+        return;
+      this->derived()->on_horizontal_swing_change(this->horizontal_swing_select_->current_option());
+    });
+  }
+#endif
+
+#ifdef USE_PANASONIC_AC_NANOEX
+  void set_nanoex_switch(switch_::Switch *nanoex_switch) {
+    this->nanoex_switch_ = nanoex_switch;
+    this->nanoex_switch_->add_on_state_callback([this](bool state) {
+      if (state == this->nanoex_state_)
+        return;
+      this->derived()->on_nanoex_change(state);
+    });
+  }
+#endif
+
+#ifdef USE_PANASONIC_AC_ECO
+  void set_eco_switch(switch_::Switch *eco_switch) {
+    this->eco_switch_ = eco_switch;
+    this->eco_switch_->add_on_state_callback([this](bool state) {
+      if (state == this->eco_state_)
+        return;
+      this->derived()->on_eco_change(state);
+    });
+  }
+#endif
+
+#ifdef USE_PANASONIC_AC_ECONAVI
+  void set_econavi_switch(switch_::Switch *econavi_switch) {
+    this->econavi_switch_ = econavi_switch;
+    this->econavi_switch_->add_on_state_callback([this](bool state) {
+      if (state == this->econavi_state_)
+        return;
+      this->derived()->on_econavi_change(state);
+    });
+  }
+#endif
+
+#ifdef USE_PANASONIC_AC_MILD_DRY
+  void set_mild_dry_switch(switch_::Switch *mild_dry_switch) {
+    this->mild_dry_switch_ = mild_dry_switch;
+    this->mild_dry_switch_->add_on_state_callback([this](bool state) {
+      if (state == this->mild_dry_state_)
+        return;
+      this->derived()->on_mild_dry_change(state);
+    });
+  }
+#endif
+
+ protected:
+  size_t get_instance_size() const override { return sizeof(Derived); }
+
+  Derived *derived() { return static_cast<Derived *>(this); }
 };
 
 }  // namespace panasonic_ac
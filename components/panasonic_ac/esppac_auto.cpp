@@ -0,0 +1,369 @@
+#include "esppac_auto.h"
+#include "esppac_commands_cnt.h"
+#include "esppac_commands_wlan.h"
+
+#include "esphome/core/application.h"
+#include "esphome/core/log.h"
+
+#include <algorithm>
+
+namespace esphome {
+namespace panasonic_ac {
+
+static const char *const TAG = "panasonic_ac.auto";
+
+static const char *type_to_string(ACType type) {
+  switch (type) {
+    case ACType::DNSKP11:
+      return "DNSK-P11 via CN-WLAN";
+    case ACType::CZTACG1:
+      return "CZ-TACG1 via CN-CNT";
+    default:
+      return "unknown";
+  }
+}
+
+void PanasonicACAuto::setup() {
+  this->init_time_ = this->now_ms();
+
+  this->set_supported_custom_fan_modes({"Automatic", "1", "2", "3", "4", "5"});
+  this->set_supported_custom_presets({"Normal", "Powerful", "Quiet"});
+  this->update_traits();
+
+  this->pref_ =
+      global_preferences->make_preference<uint8_t>(this->get_object_id_hash() ^ PROTOCOL_PREFERENCE_VERSION, true);
+
+  uint8_t type;
+  if (this->pref_.load(&type) && (type == (uint8_t) ACType::DNSKP11 || type == (uint8_t) ACType::CZTACG1)) {
+    ESP_LOGI(TAG, "Using remembered protocol %s", type_to_string((ACType) type));
+    this->remembered_ = true;
+    this->arm_timer(Timer::InitFail, this->init_time_, PROBE_CONFIRM_TIMEOUT);
+    this->start_driver((ACType) type);
+    return;
+  }
+
+  ESP_LOGI(TAG, "Detecting protocol");
+  this->arm_timer(Timer::Init, this->init_time_, PROBE_LISTEN_TIMEOUT);
+}
+
+void PanasonicACAuto::loop() {
+  if (this->driver_ != nullptr) {
+    this->driver_->loop();
+
+    // A remembered protocol that never receives anything is probably wrong, e.g. the ESP was moved to another AC
+    bool silent = false;
+    if (this->is_timer_due(Timer::InitFail)) {
+      this->cancel_timer(Timer::InitFail);
+      silent = this->driver_->last_packet_received_ == 0;
+    }
+
+    if (silent || this->driver_->is_failed()) {
+      ESP_LOGW(TAG, "%s, rebooting to detect the protocol again",
+               silent ? "Nothing received using the remembered protocol" : "Driver failed");
+      uint8_t unknown = 0xFF;
+      this->pref_.save(&unknown);
+      App.safe_reboot();  // The driver owns the UART and the entities now, probing again needs a fresh start
+    }
+
+    return;
+  }
+
+  if (this->is_idle())
+    return;  // Nothing received and no probe due yet
+
+  if (this->receive_packet()) {
+    log_packet(this->rx_buffer_);
+
+    ACType type;
+    bool detected = this->detect_protocol(type);
+    this->rx_buffer_.clear();
+
+    if (detected) {
+      ESP_LOGI(TAG, "Detected protocol %s", type_to_string(type));
+      this->cancel_timer(Timer::Init);
+
+      uint8_t value = (uint8_t) type;
+      this->pref_.save(&value);
+
+      this->start_driver(type);
+      return;
+    }
+  }
+
+  handle_probe();
+}
+
+void PanasonicACAuto::dump_config() {
+  ESP_LOGCONFIG(TAG, "Panasonic AC protocol detection:");
+
+  if (this->driver_ == nullptr) {
+    ESP_LOGCONFIG(TAG, "  Protocol: not detected yet");
+    return;
+  }
+
+  ESP_LOGCONFIG(TAG, "  Protocol: %s (%s)", type_to_string(this->type_), this->remembered_ ? "remembered" : "detected");
+  this->driver_->dump_config();
+}
+
+uint32_t PanasonicACAuto::get_time_to_next_deadline() {
+  uint32_t wait = PanasonicAC::get_time_to_next_deadline();
+
+  if (this->driver_ != nullptr)
+    wait = std::min(wait, this->driver_->get_time_to_next_deadline());
+
+  return wait;
+}
+
+#ifdef USE_PANASONIC_AC_FLIGHT_RECORDER
+void PanasonicACAuto::dump_flight_recorder() {
+  if (this->driver_ == nullptr) {
+    ESP_LOGW(TAG, "Protocol not detected yet, nothing recorded");
+    return;
+  }
+
+  this->driver_->dump_flight_recorder();
+}
+#endif
+
+/*
+ * ESPHome control request, handled by the driver which publishes the state through mirror_state()
+ */
+
+void PanasonicACAuto::control(const climate::ClimateCall &call) {
+  if (this->driver_ == nullptr) {
+    ESP_LOGW(TAG, "Ignoring control request, protocol not detected yet");
+    this->publish_state();  // Revert the frontend
+    return;
+  }
+
+  this->driver_->control(call);
+}
+
+climate::ClimateTraits PanasonicACAuto::traits() {
+  return this->driver_ != nullptr ? this->driver_->get_traits() : this->traits_;
+}
+
+/*
+ * Probe handling
+ *
+ * Every round listens for a CN-WLAN sync packet first, then sends a CN-CNT poll and finally the first two CN-WLAN
+ * handshake packets, spaced by the Init timer like every other step. Each probe gets a bounded time to be answered,
+ * rounds repeat until the AC answers.
+ */
+
+void PanasonicACAuto::handle_probe() {
+  if (!this->is_timer_due(Timer::Init))
+    return;
+
+  switch (this->probe_state_) {
+    case ProbeState::Listening: {
+      ESP_LOGD(TAG, "Probing CN-CNT");
+
+      std::vector<uint8_t> packet(sizeof(CNT::CMD_POLL) + CNT::FRAME_OVERHEAD);
+      CNT::encode_frame(CNT::POLL_HEADER, CNT::CMD_POLL, sizeof(CNT::CMD_POLL), packet.data());
+      send_probe(packet);
+
+      this->probe_state_ = ProbeState::ProbingCNT;
+      break;
+    }
+    case ProbeState::ProbingCNT:
+      ESP_LOGD(TAG, "Probing CN-WLAN");
+
+      // Same as the start of the handshake, the AC only answers the second packet
+      send_handshake_probe(WLAN::CMD_HANDSHAKE_1, sizeof(WLAN::CMD_HANDSHAKE_1), 0);
+
+      this->probe_state_ = ProbeState::StartingWLAN;
+      break;
+    case ProbeState::StartingWLAN:
+      send_handshake_probe(WLAN::CMD_HANDSHAKE_2, sizeof(WLAN::CMD_HANDSHAKE_2), 1);
+
+      this->probe_state_ = ProbeState::ProbingWLAN;
+      break;
+    default:
+      ESP_LOGW(TAG, "AC did not answer any probe, trying again");
+      this->probe_state_ = ProbeState::Listening;
+      break;
+  }
+
+  uint32_t timeout;
+  if (this->probe_state_ == ProbeState::Listening)
+    timeout = PROBE_LISTEN_TIMEOUT;
+  else if (this->probe_state_ == ProbeState::StartingWLAN)
+    timeout = PROBE_HANDSHAKE_SPACING;
+  else
+    timeout = PROBE_RESPONSE_TIMEOUT;
+
+  this->arm_timer(Timer::Init, this->now_ms(), timeout);
+}
+
+/*
+ * Returns true and sets type if rx_buffer_ holds a valid packet of either protocol
+ */
+bool PanasonicACAuto::detect_protocol(ACType &type) {
+  FrameView frame(this->rx_buffer_);
+
+  if (frame.size() >= WLAN::MIN_FRAME_SIZE && frame[0] == WLAN::SYNC_HEADER) {
+    type = ACType::DNSKP11;  // Only CN-WLAN sends sync packets
+    return true;
+  }
+
+  if (CNT::check_frame(frame) == FrameError::None) {
+    type = ACType::CZTACG1;
+    return true;
+  }
+
+  if (WLAN::check_frame(frame) == FrameError::None) {
+    type = ACType::DNSKP11;
+    return true;
+  }
+
+  ESP_LOGD(TAG, "Ignoring packet of unknown protocol");
+  return false;
+}
+
+void PanasonicACAuto::send_handshake_probe(const uint8_t *command, size_t length, uint8_t counter) {
+  std::vector<uint8_t> packet(length + 3);  // Header, packet counter and checksum
+  std::copy(command, command + length, packet.begin() + 2);
+  WLAN::seal_frame(packet.data(), packet.size(), counter);
+  send_probe(packet);
+}
+
+void PanasonicACAuto::send_probe(const std::vector<uint8_t> &packet) {
+  this->last_packet_sent_ = this->now_ms();
+
+  write_array(packet);       // Write to UART
+  log_packet(packet, true);  // Write to log
+}
+
+/*
+ * Driver handling
+ */
+
+void PanasonicACAuto::start_driver(ACType type) {
+  this->type_ = type;
+  this->probe_state_ = ProbeState::Detected;
+
+  if (type == ACType::CZTACG1) {
+    auto *driver = this->create_driver<CNT::PanasonicACCNT>();
+
+#ifdef USE_PANASONIC_AC_ECO
+    if (this->eco_switch_ != nullptr)
+      driver->set_eco_switch(this->eco_switch_);
+#endif
+#ifdef USE_PANASONIC_AC_ECONAVI
+    if (this->econavi_switch_ != nullptr)
+      driver->set_econavi_switch(this->econavi_switch_);
+#endif
+#ifdef USE_PANASONIC_AC_MILD_DRY
+    if (this->mild_dry_switch_ != nullptr)
+      driver->set_mild_dry_switch(this->mild_dry_switch_);
+#endif
+
+    this->driver_ = driver;
+  } else {
+    auto *driver = this->create_driver<WLAN::PanasonicACWLAN>();
+
+#ifdef USE_PANASONIC_AC_UNKNOWN_FIELDS_SENSOR
+    if (this->unknown_fields_sensor_ != nullptr)
+      driver->set_unknown_fields_sensor(this->unknown_fields_sensor_);
+#endif
+#ifdef USE_PANASONIC_AC_ECO
+    if (this->eco_switch_ != nullptr)
+      ESP_LOGW(TAG, "Eco switch is not supported via CN-WLAN");
+#endif
+#ifdef USE_PANASONIC_AC_ECONAVI
+    if (this->econavi_switch_ != nullptr)
+      ESP_LOGW(TAG, "Econavi switch is not supported via CN-WLAN");
+#endif
+#ifdef USE_PANASONIC_AC_MILD_DRY
+    if (this->mild_dry_switch_ != nullptr)
+      ESP_LOGW(TAG, "Mild dry switch is not supported via CN-WLAN");
+#endif
+
+    this->driver_ = driver;
+  }
+
+  this->driver_->add_on_state_callback([this](climate::Climate & /*unused*/) { this->mirror_state(); });
+  this->driver_->setup();
+
+  if (type == ACType::DNSKP11 && !this->remembered_) {
+    // The AC just answered, start the handshake right away instead of after INIT_TIMEOUT
+    this->driver_->init_time_ -= WLAN::INIT_TIMEOUT;
+    this->driver_->arm_timer(Timer::Init, this->driver_->init_time_, WLAN::INIT_TIMEOUT);
+  }
+}
+
+/*
+ * Create a driver that shares the UART, entities and settings of this component
+ */
+template<typename Driver> Driver *PanasonicACAuto::create_driver() {
+  auto *driver = new Driver();  // Lives as long as the ESP runs
+  driver->set_internal(true);   // Only this climate entity is exposed
+
+  driver->set_uart_parent(this->parent_);
+  driver->set_clock(this->clock_, this->clock_us_);
+  driver->set_rx_task(this->driver_rx_task_);
+  driver->set_command_debounce(this->command_debounce_);
+  driver->set_command_max_delay(this->command_max_delay_);
+  driver->set_command_max_age(this->command_max_age_);
+  driver->set_outside_temperature_offset(this->outside_temperature_offset_);
+  driver->set_current_temperature_offset(this->current_temperature_offset_);
+
+#ifdef USE_PANASONIC_AC_FLIGHT_RECORDER
+  if (this->recorder_size_ > 0)
+    driver->set_flight_recorder_size(this->recorder_size_);
+#endif
+#ifdef USE_PANASONIC_AC_OUTSIDE_TEMPERATURE
+  if (this->outside_temperature_sensor_ != nullptr)
+    driver->set_outside_temperature_sensor(this->outside_temperature_sensor_);
+#endif
+#ifdef USE_PANASONIC_AC_POWER_CONSUMPTION
+  if (this->current_power_consumption_sensor_ != nullptr)
+    driver->set_current_power_consumption_sensor(this->current_power_consumption_sensor_);
+#endif
+#ifdef USE_PANASONIC_AC_DEFROST
+  if (this->defrost_sensor_ != nullptr)
+    driver->set_defrost_sensor(this->defrost_sensor_);
+#endif
+#ifdef USE_PANASONIC_AC_CURRENT_TEMPERATURE_SENSOR
+  if (this->current_temperature_sensor_ != nullptr) {
+    driver->set_current_temperature_min_interval(this->current_temperature_min_interval_);
+    driver->set_current_temperature_sensor(this->current_temperature_sensor_);
+  }
+#endif
+#ifdef USE_PANASONIC_AC_VERTICAL_SWING
+  if (this->vertical_swing_select_ != nullptr)
+    driver->set_vertical_swing_select(this->vertical_swing_select_);
+#endif
+#ifdef USE_PANASONIC_AC_HORIZONTAL_SWING
+  if (this->horizontal_swing_select_ != nullptr)
+    driver->set_horizontal_swing_select(this->horizontal_swing_select_);
+#endif
+#ifdef USE_PANASONIC_AC_NANOEX
+  if (this->nanoex_switch_ != nullptr)
+    driver->set_nanoex_switch(this->nanoex_switch_);
+#endif
+
+  return driver;
+}
+
+/*
+ * Copy the state published by the driver to this climate entity
+ */
+void PanasonicACAuto::mirror_state() {
+  this->mode = this->driver_->mode;
+  this->action = this->driver_->action;
+  this->swing_mode = this->driver_->swing_mode;
+  this->current_temperature = this->driver_->current_temperature;
+  this->target_temperature = this->driver_->target_temperature;
+
+  if (this->driver_->has_custom_fan_mode())
+    this->set_custom_fan_mode_(this->driver_->get_custom_fan_mode().c_str());
+  if (this->driver_->has_custom_preset())
+    this->set_custom_preset_(this->driver_->get_custom_preset().c_str());
+
+  this->publish_state();
+}
+
+}  // namespace panasonic_ac
+}  // namespace esphome
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "esphome/core/preferences.h"
+#include "esppac.h"
+#include "esppac_cnt.h"
+#include "esppac_wlan.h"
+
+namespace esphome {
+namespace panasonic_ac {
+
+static const int PROBE_LISTEN_TIMEOUT = 5000;     // Time to listen for a CN-WLAN sync packet before sending probes
+static const int PROBE_RESPONSE_TIMEOUT = 1000;   // Time to wait for the AC to answer a probe
+static const int PROBE_CONFIRM_TIMEOUT = 60000;   // Time a remembered protocol gets to receive its first packet
+static const int PROBE_HANDSHAKE_SPACING = 3;     // Pause between the two handshake probes, like the real wifi adapter
+static const uint32_t PROTOCOL_PREFERENCE_VERSION = 0x50414301;  // Keeps the preference apart from the climate state
+
+enum class ProbeState : uint8_t {
+  Listening,     // Waiting for a CN-WLAN sync packet
+  ProbingCNT,    // CN-CNT poll sent, waiting for the poll response
+  StartingWLAN,  // First CN-WLAN handshake packet sent, the second follows after PROBE_HANDSHAKE_SPACING
+  ProbingWLAN,   // CN-WLAN handshake sent, waiting for its answer
+  Detected       // Protocol known, all work is done by the driver
+};
+
+/*
+ * Detects the protocol spoken by the AC and hands over to the matching driver
+ *
+ * The detected protocol is remembered in flash so later boots skip probing. Entities and settings are collected here
+ * and passed to the driver once it is created, the state of the driver is mirrored to this climate entity.
+ */
+class PanasonicACAuto : public PanasonicAC {
+ public:
+  // Setters of the driver entities, applied once the protocol is known
+#ifdef USE_PANASONIC_AC_VERTICAL_SWING
+  void set_vertical_swing_select(select::Select *vertical_swing_select) {
+    this->vertical_swing_select_ = vertical_swing_select;
+  }
+#endif
+#ifdef USE_PANASONIC_AC_HORIZONTAL_SWING
+  void set_horizontal_swing_select(select::Select *horizontal_swing_select) {
+    this->horizontal_swing_select_ = horizontal_swing_select;
+  }
+#endif
+#ifdef USE_PANASONIC_AC_NANOEX
+  void set_nanoex_switch(switch_::Switch *nanoex_switch) { this->nanoex_switch_ = nanoex_switch; }
+#endif
+#ifdef USE_PANASONIC_AC_ECO
+  void set_eco_switch(switch_::Switch *eco_switch) { this->eco_switch_ = eco_switch; }
+#endif
+#ifdef USE_PANASONIC_AC_ECONAVI
+  void set_econavi_switch(switch_::Switch *econavi_switch) { this->econavi_switch_ = econavi_switch; }
+#endif
+#ifdef USE_PANASONIC_AC_MILD_DRY
+  void set_mild_dry_switch(switch_::Switch *mild_dry_switch) { this->mild_dry_switch_ = mild_dry_switch; }
+#endif
+#ifdef USE_PANASONIC_AC_CURRENT_TEMPERATURE_SENSOR
+  void set_current_temperature_sensor(sensor::Sensor *current_temperature_sensor) {
+    this->current_temperature_sensor_ = current_temperature_sensor;  // The driver subscribes to it
+  }
+#endif
+#ifdef USE_PANASONIC_AC_UNKNOWN_FIELDS_SENSOR
+  void set_unknown_fields_sensor(text_sensor::TextSensor *unknown_fields_sensor) {
+    this->unknown_fields_sensor_ = unknown_fields_sensor;
+  }
+#endif
+  void set_rx_task(bool rx_task) { this->driver_rx_task_ = rx_task; }  // Only the driver reads in a task
+
+#ifdef USE_PANASONIC_AC_FLIGHT_RECORDER
+  void dump_flight_recorder();  // Hides the one of PanasonicAC, the packets are recorded by the driver
+#endif
+  uint32_t get_time_to_next_deadline();  // Hides the one of PanasonicAC, includes the deadlines of the driver
+
+  void control(const climate::ClimateCall &call) override;
+
+  void setup() override;
+  void loop() override;
+  void dump_config() override;
+
+ protected:
+  PanasonicAC *driver_ = nullptr;  // Created once the protocol is known
+  ACType type_ = ACType::DNSKP11;  // Protocol of the driver
+  ProbeState probe_state_ = ProbeState::Listening;
+  bool remembered_ = false;      // Set if the protocol was restored from flash instead of detected
+  bool driver_rx_task_ = false;  // Passed on to the driver
+  ESPPreferenceObject pref_;     // Stores the detected protocol
+
+#ifdef USE_PANASONIC_AC_UNKNOWN_FIELDS_SENSOR
+  text_sensor::TextSensor *unknown_fields_sensor_ = nullptr;
+#endif
+
+  climate::ClimateTraits traits() override;
+  size_t get_instance_size() const override { return sizeof(PanasonicACAuto); }
+
+  void handle_probe();
+  bool detect_protocol(ACType &type);
+  void send_probe(const std::vector<uint8_t> &packet);
+  void send_handshake_probe(const uint8_t *command, size_t length, uint8_t counter);
+
+  void start_driver(ACType type);
+  template<typename Driver> Driver *create_driver();
+  void mirror_state();
+};
+
+}  // namespace panasonic_ac
+}  // namespace esphome
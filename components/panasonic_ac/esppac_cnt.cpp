@@ -1,5 +1,7 @@
 #include "esppac_cnt.h"
 #include "esppac_commands_cnt.h"
+#include "esppac_conformance_cnt.h"
+#include "esppac_registers_cnt.h"
 
 #include "esphome/core/log.h"
 
@@ -10,132 +12,70 @@ namespace CNT {
 static const char *const TAG = "panasonic_ac.cz_tacg1";
 
 static climate::ClimateMode determine_mode(uint8_t mode) {
-  uint8_t nib1 = (mode >> 4) & 0x0F;  // Left nib for mode
-  uint8_t nib2 = (mode >> 0) & 0x0F;  // Right nib for power state
+  const ModeValue *entry = find_value(MODES, mode);
 
-  if (nib2 == 0x00)
+  if (entry == nullptr) {
+    ESP_LOGW(TAG, "Received unknown climate mode");
     return climate::CLIMATE_MODE_OFF;
-
-  switch (nib1) {
-    case 0x00:  // Auto
-      return climate::CLIMATE_MODE_HEAT_COOL;
-    case 0x03:  // Cool
-      return climate::CLIMATE_MODE_COOL;
-    case 0x04:  // Heat
-      return climate::CLIMATE_MODE_HEAT;
-    case 0x02:  // Dry
-      return climate::CLIMATE_MODE_DRY;
-    case 0x06:  // Fan only
-      return climate::CLIMATE_MODE_FAN_ONLY;
-    default:
-      ESP_LOGW(TAG, "Received unknown climate mode");
-      return climate::CLIMATE_MODE_OFF;
   }
+
+  return entry->mode;
 }
 
 static const char *determine_fan_speed(uint8_t speed) {
-  switch (speed) {
-    case 0xA0:  // Auto
-      return "Automatic";
-    case 0x30:  // 1
-      return "1";
-    case 0x40:  // 2
-      return "2";
-    case 0x50:  // 3
-      return "3";
-    case 0x60:  // 4
-      return "4";
-    case 0x70:  // 5
-      return "5";
-    default:
-      ESP_LOGW(TAG, "Received unknown fan speed");
-      return "Unknown";
+  const NamedValue *entry = find_value(FAN_SPEEDS, speed);
+
+  if (entry == nullptr) {
+    ESP_LOGW(TAG, "Received unknown fan speed");
+    return "Unknown";
   }
+
+  return entry->name;
 }
 
 static const char *determine_vertical_swing(uint8_t swing) {
-  uint8_t nib = (swing >> 4) & 0x0F;  // Left nib for vertical swing
-
-  switch (nib) {
-    case 0x0E:
-      return "swing";
-    case 0x0F:
-      return "auto";
-    case 0x01:
-      return "up";
-    case 0x02:
-      return "up_center";
-    case 0x03:
-      return "center";
-    case 0x04:
-      return "down_center";
-    case 0x05:
-      return "down";
-    case 0x00:
-      return "unsupported";
-    default:
-      ESP_LOGW(TAG, "Received unknown vertical swing mode: 0x%02X", nib);
-      return "Unknown";
+  if (swing == VERTICAL_SWING_UNSUPPORTED)
+    return SWING_UNSUPPORTED;
+
+  const NamedValue *entry = find_value(VERTICAL_SWINGS, swing);
+
+  if (entry == nullptr) {
+    ESP_LOGW(TAG, "Received unknown vertical swing mode: 0x%02X", swing >> 4);
+    return "Unknown";
   }
+
+  return entry->name;
 }
 
 static const char *determine_horizontal_swing(uint8_t swing) {
-  uint8_t nib = (swing >> 0) & 0x0F;  // Right nib for horizontal swing
-
-  switch (nib) {
-    case 0x0D:
-      return "auto";
-    case 0x09:
-      return "left";
-    case 0x0A:
-      return "left_center";
-    case 0x06:
-      return "center";
-    case 0x0B:
-      return "right_center";
-    case 0x0C:
-      return "right";
-    case 0x00:
-      return "unsupported";
-    default:
-      ESP_LOGW(TAG, "Received unknown horizontal swing mode");
-      return "Unknown";
-  }
-}
+  if (swing == HORIZONTAL_SWING_UNSUPPORTED)
+    return SWING_UNSUPPORTED;
 
-static const char *determine_preset(uint8_t preset) {
-  uint8_t nib = (preset >> 0) & 0x0F;  // Right nib for preset (powerful/quiet)
-
-  switch (nib) {
-    case 0x02:
-      return "Powerful";
-    case 0x04:
-      return "Quiet";
-    case 0x00:
-      return "Normal";
-    default:
-      ESP_LOGW(TAG, "Received unknown preset");
-      return "Normal";
+  const NamedValue *entry = find_value(HORIZONTAL_SWINGS, swing);
+
+  if (entry == nullptr) {
+    ESP_LOGW(TAG, "Received unknown horizontal swing mode");
+    return "Unknown";
   }
+
+  return entry->name;
 }
 
-static bool determine_preset_nanoex(uint8_t preset) {
-  uint8_t nib = (preset >> 4) & 0x04;  // Left nib for nanoex
+static const char *determine_preset(uint8_t preset) {
+  const NamedValue *entry = find_value(PRESETS, preset);
 
-  if (nib == 0x04)
-    return true;
-  else if (nib == 0x00)
-    return false;
-  else {
-    ESP_LOGW(TAG, "Received unknown nanoex value");
-    return false;
+  if (entry == nullptr) {
+    ESP_LOGW(TAG, "Received unknown preset");
+    return "Normal";
   }
+
+  return entry->name;
 }
 
 static bool determine_eco(uint8_t value) {
-  if (value == 0x40)
+  if (value == ECO_ON)
     return true;
-  else if (value == 0x00)
+  else if (value == ECO_OFF)
     return false;
   else {
     ESP_LOGW(TAG, "Received unknown eco value");
@@ -143,23 +83,10 @@ static bool determine_eco(uint8_t value) {
   }
 }
 
-static bool determine_econavi(uint8_t value) {
-  uint8_t nib = value & 0x10;
-
-  if (nib == 0x10)
-    return true;
-  else if (nib == 0x00)
-    return false;
-  else {
-    ESP_LOGW(TAG, "Received unknown econavi value");
-    return false;
-  }
-}
-
 static bool determine_mild_dry(uint8_t value) {
-  if (value == 0x7F)
+  if (value == MILD_DRY_ON)
     return true;
-  else if (value == 0x80)
+  else if (value == MILD_DRY_OFF)
     return false;
   else {
     ESP_LOGW(TAG, "Received unknown mild dry value");
@@ -167,21 +94,24 @@ static bool determine_mild_dry(uint8_t value) {
   }
 }
 
-uint16_t determine_power_consumption(uint8_t byte_28, uint8_t byte_29, uint8_t offset) {
-  return (uint16_t) (byte_28 + (byte_29 * 256)) - offset;
-}
-
 void PanasonicACCNT::setup() {
   PanasonicAC::setup();
 
+  if (this->is_passive()) {
+    ESP_LOGD(TAG, "Listening to CZ-TACG1 protocol via CN-CNT");  // The official adapter polls, we never send
+    return;
+  }
+
+  this->arm_timer(Timer::Poll, this->init_time_, POLL_INTERVAL);  // Staggered if several ACs are configured
+
   ESP_LOGD(TAG, "Using CZ-TACG1 protocol via CN-CNT");
 }
 
 void PanasonicACCNT::loop() {
-  PanasonicAC::read_data();
+  if (this->is_idle())
+    return;  // Nothing received and no deadline reached yet
 
-  if (millis() - this->last_read_ > READ_TIMEOUT &&
-      !this->rx_buffer_.empty())  // Check if our read timed out and we received something
+  if (this->receive_packet())  // Check if we received a complete packet
   {
     log_packet(this->rx_buffer_);
 
@@ -189,14 +119,25 @@ void PanasonicACCNT::loop() {
       return;
 
     this->waiting_for_response_ = false;
-    this->last_packet_received_ = millis();  // Set the time at which we received our last packet
+    this->last_packet_received_ = this->now_ms();  // Set the time at which we received our last packet
 
     handle_packet();
 
     this->rx_buffer_.clear();  // Reset buffer
   }
+
+#ifdef USE_PANASONIC_AC_PASSIVE
+  if (this->receive_controller_packet()) {
+    log_packet(this->controller_buffer_, true);  // Recorded as outgoing, it travels the way our commands would
+    handle_controller_packet();
+    this->controller_buffer_.clear();
+  }
+#endif
+
   handle_cmd();
   handle_poll();  // Handle sending poll packets
+
+  handle_current_temperature_sensor();  // Publish rate limited external temperature updates
 }
 
 /*
@@ -204,45 +145,33 @@ void PanasonicACCNT::loop() {
  */
 
 void PanasonicACCNT::control(const climate::ClimateCall &call) {
-  if (this->state_ != ACState::Ready)
+  if (this->is_passive()) {
+    ESP_LOGW(TAG, "Ignoring control request in passive mode");
+    this->publish_state();  // Revert the frontend to the observed state
     return;
-
-  if (this->cmd.empty()) {
-    ESP_LOGV(TAG, "Copying data to cmd");
-    this->cmd = this->data;
   }
 
+  this->schedule_command();
+
   if (call.get_mode().has_value()) {
     ESP_LOGV(TAG, "Requested mode change");
 
-    switch (*call.get_mode()) {
-      case climate::CLIMATE_MODE_COOL:
-        this->cmd[0] = 0x34;
-        break;
-      case climate::CLIMATE_MODE_HEAT:
-        this->cmd[0] = 0x44;
-        break;
-      case climate::CLIMATE_MODE_DRY:
-        this->cmd[0] = 0x24;
-        break;
-      case climate::CLIMATE_MODE_HEAT_COOL:
-        this->cmd[0] = 0x04;
-        break;
-      case climate::CLIMATE_MODE_FAN_ONLY:
-        this->cmd[0] = 0x64;
-        break;
-      case climate::CLIMATE_MODE_OFF:
-        this->cmd[0] = this->cmd[0] & 0xF0;  // Strip right nib to turn AC off
-        break;
-      default:
-        ESP_LOGV(TAG, "Unsupported mode requested");
-        break;
+    climate::ClimateMode mode = *call.get_mode();
+    const ModeValue *entry = find_mode(MODES, mode);
+
+    if (mode == climate::CLIMATE_MODE_OFF) {
+      this->cmd.set_power(false);  // Keep the mode, only turn the AC off
+    } else if (entry != nullptr) {
+      this->cmd.set_mode(entry->value);
+      this->cmd.set_power(true);
+    } else {
+      ESP_LOGV(TAG, "Unsupported mode requested");
     }
   }
 
   if (call.get_target_temperature().has_value()) {
     ESP_LOGV(TAG, "Requested target temp change to %.2f, %.2f including offset", *call.get_target_temperature(), *call.get_target_temperature() - this->current_temperature_offset_);
-    this->cmd[1] = (*call.get_target_temperature() - this->current_temperature_offset_) / TEMPERATURE_STEP;
+    this->cmd.set_target_temperature(this->encode_target_temperature(*call.get_target_temperature()));
   }
 
   if (call.has_custom_fan_mode()) {
@@ -250,23 +179,13 @@ void PanasonicACCNT::control(const climate::ClimateCall &call) {
 
     if (this->get_custom_preset() != "Normal") {
       ESP_LOGV(TAG, "Resetting preset");
-      this->cmd[5] = (this->cmd[5] & 0xF0);  // Clear right nib for normal mode
+      this->cmd.set_preset(PRESET_NORMAL);
     }
 
-    const auto fanMode = call.get_custom_fan_mode();
-
-    if (fanMode == "Automatic")
-      this->cmd[3] = 0xA0;
-    else if (fanMode == "1")
-      this->cmd[3] = 0x30;
-    else if (fanMode == "2")
-      this->cmd[3] = 0x40;
-    else if (fanMode == "3")
-      this->cmd[3] = 0x50;
-    else if (fanMode == "4")
-      this->cmd[3] = 0x60;
-    else if (fanMode == "5")
-      this->cmd[3] = 0x70;
+    const NamedValue *entry = find_name(FAN_SPEEDS, call.get_custom_fan_mode());
+
+    if (entry != nullptr)
+      this->cmd.set_fan_speed(entry->value);
     else
       ESP_LOGV(TAG, "Unsupported fan mode requested");
   }
@@ -274,104 +193,54 @@ void PanasonicACCNT::control(const climate::ClimateCall &call) {
   if (call.get_swing_mode().has_value()) {
     ESP_LOGV(TAG, "Requested swing mode change");
 
-    switch (*call.get_swing_mode()) {
-      case climate::CLIMATE_SWING_BOTH:
-        this->cmd[4] = 0xFD;
-        break;
-      case climate::CLIMATE_SWING_OFF:
-        this->cmd[4] = 0x36;  // Reset both to center
-        break;
-      case climate::CLIMATE_SWING_VERTICAL:
-        this->cmd[4] = 0xF6;  // Swing vertical, horizontal center
-        break;
-      case climate::CLIMATE_SWING_HORIZONTAL:
-        this->cmd[4] = 0x3D;  // Swing horizontal, vertical center
-        break;
-      default:
-        ESP_LOGV(TAG, "Unsupported swing mode requested");
-        break;
+    const SwingPair *entry = find_swing_pair(SWING_MODES, *call.get_swing_mode());
+
+    if (entry != nullptr) {
+      this->cmd.set_vertical_swing(entry->vertical);
+      this->cmd.set_horizontal_swing(entry->horizontal);
+
+      // Show the positions right away, so a select change before the next poll is compared against them
+      this->update_swing_vertical(StringRef(determine_vertical_swing(entry->vertical)));
+      this->update_swing_horizontal(StringRef(determine_horizontal_swing(entry->horizontal)));
+    } else {
+      ESP_LOGV(TAG, "Unsupported swing mode requested");
     }
   }
 
   if (call.has_custom_preset()) {
     ESP_LOGV(TAG, "Requested preset change");
 
-    const auto preset = call.get_custom_preset();
+    const NamedValue *entry = find_name(PRESETS, call.get_custom_preset());
 
-    if (preset == "Normal")
-      this->cmd[5] = (this->cmd[5] & 0xF0);  // Clear right nib for normal mode
-    else if (preset == "Powerful")
-      this->cmd[5] = (this->cmd[5] & 0xF0) + 0x02;  // Clear right nib and set powerful mode
-    else if (preset == "Quiet")
-      this->cmd[5] = (this->cmd[5] & 0xF0) + 0x04;  // Clear right nib and set quiet mode
+    if (entry != nullptr)
+      this->cmd.set_preset(entry->value);
     else
       ESP_LOGV(TAG, "Unsupported preset requested");
   }
+
+  this->stamp_changes();
+  this->publish_optimistic_state(call);
 }
 
 /*
  * Set the data array to the fields
  */
-void PanasonicACCNT::set_data(bool set) {
-  this->mode = determine_mode(this->data[0]);
-  this->set_custom_fan_mode_(determine_fan_speed(this->data[3]));
-
-  StringRef verticalSwing(determine_vertical_swing(this->data[4]));
-  StringRef horizontalSwing(determine_horizontal_swing(this->data[4]));
-
-  const char *preset = determine_preset(this->data[5]);
-  bool nanoex = determine_preset_nanoex(this->data[5]);
-  bool eco = determine_eco(this->data[8]);
-  bool econavi = determine_econavi(this->data[5]);
-  bool mildDry = determine_mild_dry(this->data[2]);
-
-  this->update_target_temperature((int8_t) this->data[1]);
-
-  if (set) {
-    // Also set current and outside temperature
-    // 128 means not supported
-    if (this->current_temperature_sensor_ == nullptr) {
-      if (this->rx_buffer_[18] != 0x80)
-        this->update_current_temperature((int8_t) this->rx_buffer_[18]);
-      else if (this->rx_buffer_[21] != 0x80)
-        this->update_current_temperature((int8_t) this->rx_buffer_[21]);
-      else
-        ESP_LOGV(TAG, "Current temperature is not supported");
-    }
+void PanasonicACCNT::set_data() {
+  this->mode = this->data.power() ? determine_mode(this->data.mode()) : climate::CLIMATE_MODE_OFF;
+  this->set_custom_fan_mode_(determine_fan_speed(this->data.fan_speed()));
 
-    if (this->outside_temperature_sensor_ != nullptr) {
-      if (this->rx_buffer_[19] != 0x80)
-        this->update_outside_temperature((int8_t) this->rx_buffer_[19]);
-      else if (this->rx_buffer_[22] != 0x80)
-        this->update_outside_temperature((int8_t) this->rx_buffer_[22]);
-      else
-        ESP_LOGV(TAG, "Outside temperature is not supported");
-    }
+  StringRef verticalSwing(determine_vertical_swing(this->data.vertical_swing()));
+  StringRef horizontalSwing(determine_horizontal_swing(this->data.horizontal_swing()));
 
-    if (this->current_power_consumption_sensor_ != nullptr) {
-      uint16_t power_consumption = determine_power_consumption(
-          (int8_t) this->rx_buffer_[28], (int8_t) this->rx_buffer_[29], (int8_t) this->rx_buffer_[30]);
-      this->update_current_power_consumption(power_consumption);
-    }
+  const char *preset = determine_preset(this->data.preset());
+  bool nanoex = this->data.nanoex();
+  bool eco = determine_eco(this->data.eco());
+  bool econavi = this->data.econavi();
+  bool mildDry = determine_mild_dry(this->data.mild_dry());
 
-    if (this->defrost_sensor_ != nullptr) {
-      if (this->rx_buffer_.size() >= 15) {
-        bool defrost = (this->rx_buffer_[14] == 0x02);
-        update_defrost(defrost);
-      } else {
-        ESP_LOGV(TAG, "Defrost status is not supported");
-      }
-    }
-  }
+  this->update_target_temperature((int8_t) this->data.target_temperature());
 
-  if (verticalSwing == "auto" && horizontalSwing == "auto")
-    this->swing_mode = climate::CLIMATE_SWING_BOTH;
-  else if (verticalSwing == "auto")
-    this->swing_mode = climate::CLIMATE_SWING_VERTICAL;
-  else if (horizontalSwing == "auto")
-    this->swing_mode = climate::CLIMATE_SWING_HORIZONTAL;
-  else
-    this->swing_mode = climate::CLIMATE_SWING_OFF;
+  this->swing_mode = determine_swing(this->data.vertical_swing(), this->data.horizontal_swing());
 
   this->update_swing_vertical(verticalSwing);
   this->update_swing_horizontal(horizontalSwing);
@@ -385,28 +254,98 @@ void PanasonicACCNT::set_data(bool set) {
 }
 
 /*
- * Send a command, attaching header, packet length and checksum
+ * Set the sensor values following the state block to the fields
  */
-void PanasonicACCNT::send_command(std::vector<uint8_t> command, CommandType type, uint8_t header = CNT::CTRL_HEADER) {
-  uint8_t length = command.size();
-  command.insert(command.begin(), header);
-  command.insert(command.begin() + 1, length);
+void PanasonicACCNT::set_sensor_data(FrameView frame) {
+  // Current and outside temperature
+  // 128 means not supported
+#ifdef USE_PANASONIC_AC_CURRENT_TEMPERATURE_SENSOR
+  bool use_ac_temperature = this->current_temperature_sensor_ == nullptr;
+#else
+  bool use_ac_temperature = true;
+#endif
+
+  if (use_ac_temperature) {
+    if (frame.get(QUERY_CURRENT_TEMPERATURE, TEMPERATURE_NOT_SUPPORTED) != TEMPERATURE_NOT_SUPPORTED)
+      this->update_current_temperature((int8_t) frame[QUERY_CURRENT_TEMPERATURE]);
+    else if (frame.get(QUERY_CURRENT_TEMPERATURE_ALT, TEMPERATURE_NOT_SUPPORTED) != TEMPERATURE_NOT_SUPPORTED)
+      this->update_current_temperature((int8_t) frame[QUERY_CURRENT_TEMPERATURE_ALT]);
+    else
+      ESP_LOGV(TAG, "Current temperature is not supported");
+  }
 
-  uint8_t checksum = 0;
+#ifdef USE_PANASONIC_AC_OUTSIDE_TEMPERATURE
+  if (this->outside_temperature_sensor_ != nullptr) {
+    if (frame.get(QUERY_OUTSIDE_TEMPERATURE, TEMPERATURE_NOT_SUPPORTED) != TEMPERATURE_NOT_SUPPORTED)
+      this->update_outside_temperature((int8_t) frame[QUERY_OUTSIDE_TEMPERATURE]);
+    else if (frame.get(QUERY_OUTSIDE_TEMPERATURE_ALT, TEMPERATURE_NOT_SUPPORTED) != TEMPERATURE_NOT_SUPPORTED)
+      this->update_outside_temperature((int8_t) frame[QUERY_OUTSIDE_TEMPERATURE_ALT]);
+    else
+      ESP_LOGV(TAG, "Outside temperature is not supported");
+  }
+#endif
 
-  for (uint8_t i : command)
-    checksum -= i;  // Add to checksum
+#ifdef USE_PANASONIC_AC_POWER_CONSUMPTION
+  if (this->current_power_consumption_sensor_ != nullptr) {
+    if (frame.has(QUERY_POWER_CONSUMPTION, 3)) {
+      uint16_t power_consumption = determine_power_consumption(
+          frame[QUERY_POWER_CONSUMPTION], frame[QUERY_POWER_CONSUMPTION + 1], frame[QUERY_POWER_CONSUMPTION + 2]);
+      this->update_current_power_consumption(power_consumption);
+    } else {
+      ESP_LOGV(TAG, "Power consumption is not supported");
+    }
+  }
+#endif
 
-  command.push_back(checksum);
+#ifdef USE_PANASONIC_AC_DEFROST
+  if (this->defrost_sensor_ != nullptr) {
+    if (frame.has(QUERY_DEFROST)) {
+      bool defrost = (frame[QUERY_DEFROST] == DEFROST_ON);
+      update_defrost(defrost);
+    } else {
+      ESP_LOGV(TAG, "Defrost status is not supported");
+    }
+  }
+#endif
+}
+
+/*
+ * Compare the sensor bytes with the ones of the previous poll, returns true if any of them changed
+ */
+bool PanasonicACCNT::update_sensor_cache(FrameView frame) {
+  bool changed = frame.size() != this->sensor_cache_length_;
+  this->sensor_cache_length_ = frame.size();
+
+  for (size_t i = 0; i < sizeof(SENSOR_OFFSETS); i++) {
+    uint8_t value = frame.get(SENSOR_OFFSETS[i]);
+
+    if (value != this->sensor_cache_[i]) {
+      this->sensor_cache_[i] = value;
+      changed = true;
+    }
+  }
+
+  return changed;
+}
 
-  send_packet(command, type);  // Actually send the constructed packet
+/*
+ * Send a command, attaching header, packet length and checksum
+ */
+void PanasonicACCNT::send_command(const uint8_t *command, size_t length, CommandType type,
+                                  uint8_t header = CNT::CTRL_HEADER) {
+  std::vector<uint8_t> packet(length + FRAME_OVERHEAD);  // Reserve space for header, packet length and checksum
+  encode_frame(header, command, length, packet.data());
+
+  send_packet(packet, type);  // Actually send the constructed packet
 }
 
 /*
  * Send a raw packet, as is
  */
 void PanasonicACCNT::send_packet(const std::vector<uint8_t> &packet, CommandType type) {
-  this->last_packet_sent_ = millis();  // Save the time when we sent the last packet
+  this->last_packet_sent_ = this->now_ms();  // Save the time when we sent the last packet
+
+  this->arm_timer(Timer::Poll, this->last_packet_sent_, POLL_INTERVAL);
 
   if (type != CommandType::Response)     // Don't wait for a response for responses
     this->waiting_for_response_ = true;  // Mark that we are waiting for a response
@@ -420,18 +359,34 @@ void PanasonicACCNT::send_packet(const std::vector<uint8_t> &packet, CommandType
  */
 
 void PanasonicACCNT::handle_poll() {
-  if (millis() - this->last_packet_sent_ > POLL_INTERVAL) {
+  if (this->is_timer_due(Timer::Poll)) {
     ESP_LOGV(TAG, "Polling AC");
-    send_command(CMD_POLL, CommandType::Normal, POLL_HEADER);
+    send_command(CMD_POLL, sizeof(CMD_POLL), CommandType::Normal, POLL_HEADER);
   }
 }
 
 void PanasonicACCNT::handle_cmd() {
-  if (!this->cmd.empty() && millis() - this->last_packet_sent_ > CMD_INTERVAL) {
-    ESP_LOGV(TAG, "Sending Command");
-    send_command(this->cmd, CommandType::Normal, CTRL_HEADER);
-    this->cmd.clear();
+  if (!this->is_command_due(this->state_ == ACState::Ready, CMD_INTERVAL))
+    return;
+
+  // Sent or not, the next poll has to republish the state so rejected or dropped changes are reverted in the frontend
+  this->poll_cache_valid_ = false;
+
+  if (this->cmd.empty())
+    return;  // Nothing was changed
+
+  // Only override the fields that were changed, everything else comes from the latest poll
+  State command = this->cmd.apply(this->data);
+  this->cmd.clear();
+
+  if (command == this->data) {
+    ESP_LOGV(TAG, "Command matches current state, not sending");
+    return;
   }
+
+  ESP_LOGV(TAG, "Sending Command");
+  send_command(command.raw, STATE_SIZE, CommandType::Normal, CTRL_HEADER);
+  this->commands_sent_++;
 }
 
 /*
@@ -439,57 +394,124 @@ void PanasonicACCNT::handle_cmd() {
  */
 
 bool PanasonicACCNT::verify_packet() {
-  if (this->rx_buffer_.size() < 12) {
-    ESP_LOGW(TAG, "Dropping invalid packet (length)");
+  FrameError error = check_frame(FrameView(this->rx_buffer_));
 
-    this->rx_buffer_.clear();  // Reset buffer
-    return false;
-  }
+  if (error == FrameError::None)
+    return true;
 
-  // Check if header matches
-  if (this->rx_buffer_[0] != CTRL_HEADER && this->rx_buffer_[0] != POLL_HEADER) {
-    ESP_LOGW(TAG, "Dropping invalid packet (header)");
+  if (error == FrameError::Length || error == FrameError::Header)
+    ESP_LOGW(TAG, "Dropping invalid packet (%s)", frame_error_to_string(error));
+  else
+    ESP_LOGD(TAG, "Dropping invalid packet (%s)", frame_error_to_string(error));
 
-    this->rx_buffer_.clear();  // Reset buffer
-    return false;
-  }
+  this->rx_buffer_.clear();  // Reset buffer
+  return false;
+}
 
-  // Packet length minus header, packet length and checksum
-  if (this->rx_buffer_[1] != this->rx_buffer_.size() - 3) {
-    ESP_LOGD(TAG, "Dropping invalid packet (length mismatch)");
+void PanasonicACCNT::handle_packet() {
+  FrameView frame(this->rx_buffer_);
 
-    this->rx_buffer_.clear();  // Reset buffer
-    return false;
-  }
+  if (frame[0] == POLL_HEADER) {
+    if (!frame.has(QUERY_STATE, STATE_SIZE)) {
+      ESP_LOGW(TAG, "Poll response is too short");
+      return;
+    }
+
+    State state = load_state(frame.data() + QUERY_STATE);
+
+    // Most polls return the same payload, only decode the parts that changed
+    bool state_changed = !this->poll_cache_valid_ || state != this->data;
+    bool sensors_changed = this->update_sensor_cache(frame) || !this->poll_cache_valid_;
 
-  uint8_t checksum = 0;
+    this->poll_cache_valid_ = true;
+
+    if (state_changed) {
+      this->data = state;
+      this->set_data();
+    }
 
-  for (uint8_t b : this->rx_buffer_) {
-    checksum += b;
+    if (sensors_changed)
+      this->set_sensor_data(frame);
+
+    if (state_changed || sensors_changed)
+      this->publish_state();
+    else
+      ESP_LOGV(TAG, "Poll response unchanged");
+
+    if (this->state_ != ACState::Ready) {
+      this->state_ = ACState::Ready;  // Mark as ready after first poll
+
+      // Only offer the swing modes the AC actually has
+      this->vertical_swing_supported_ = this->data.vertical_swing() != VERTICAL_SWING_UNSUPPORTED;
+      this->horizontal_swing_supported_ = this->data.horizontal_swing() != HORIZONTAL_SWING_UNSUPPORTED;
+      this->update_traits();
+
+      if (this->expire_changes())
+        this->poll_cache_valid_ = false;  // Republish the state the expired changes were shown over
+
+      this->resume_command(!this->cmd.empty());
+    }
+  } else {
+    ESP_LOGD(TAG, "Received unknown packet");
   }
+}
 
-  if (checksum != 0) {
-    ESP_LOGD(TAG, "Dropping invalid packet (checksum)");
+#ifdef USE_PANASONIC_AC_PASSIVE
+/*
+ * Decode control frames sent by the official adapter, the AC confirms them with its next poll response
+ */
+void PanasonicACCNT::handle_controller_packet() {
+  FrameView frame(this->controller_buffer_);
+  FrameError error = check_frame(frame);
 
-    this->rx_buffer_.clear();  // Reset buffer
-    return false;
+  if (error != FrameError::None) {
+    ESP_LOGD(TAG, "Dropping invalid controller packet (%s)", frame_error_to_string(error));
+    return;
   }
 
-  return true;
+  if (frame[0] != CTRL_HEADER || !frame.has(QUERY_STATE, STATE_SIZE))
+    return;  // Polls carry no state
+
+  // Control frames carry the complete requested state at the same offset as poll responses
+  State state = load_state(frame.data() + QUERY_STATE);
+
+  if (state == this->data)
+    return;
+
+  ESP_LOGD(TAG, "Controller changed the state");
+  this->data = state;
+  this->set_data();
+  this->publish_state();
 }
+#endif
 
-void PanasonicACCNT::handle_packet() {
-  if (this->rx_buffer_[0] == POLL_HEADER) {
-    this->data = std::vector<uint8_t>(this->rx_buffer_.begin() + 2, this->rx_buffer_.begin() + 12);
+/*
+ * Change tracking
+ */
 
-    this->set_data(true);
-    this->publish_state();
+// Remembers when the fields set since the last call were changed
+void PanasonicACCNT::stamp_changes() {
+  State touched = this->cmd.take_touched();
+  uint32_t now = this->now_ms();
 
-    if (this->state_ != ACState::Ready)
-      this->state_ = ACState::Ready;  // Mark as ready after first poll
-  } else {
-    ESP_LOGD(TAG, "Received unknown packet");
+  for (uint8_t i = 0; i < FIELD_COUNT; i++) {
+    if (touched.get(FIELDS[i]) != 0)
+      this->field_changed_[i] = now;
+  }
+}
+
+// Drops the changed fields that are too old to be sent, returns true if any were dropped
+bool PanasonicACCNT::expire_changes() {
+  bool expired = false;
+
+  for (uint8_t i = 0; i < FIELD_COUNT; i++) {
+    if (this->cmd.has(FIELDS[i]) && this->is_change_expired(this->field_changed_[i])) {
+      this->cmd.clear(FIELDS[i]);
+      expired = true;
+    }
   }
+
+  return expired;
 }
 
 /*
@@ -497,143 +519,99 @@ void PanasonicACCNT::handle_packet() {
  */
 
 void PanasonicACCNT::on_vertical_swing_change(const StringRef &swing) {
-  if (this->state_ != ACState::Ready)
-    return;
-
   ESP_LOGD(TAG, "Setting vertical swing position");
 
-  if (this->cmd.empty()) {
-    ESP_LOGV(TAG, "Copying data to cmd");
-    this->cmd = this->data;
-  }
-
-  if (swing == "down")
-    this->cmd[4] = (this->cmd[4] & 0x0F) + 0x50;
-  else if (swing == "down_center")
-    this->cmd[4] = (this->cmd[4] & 0x0F) + 0x40;
-  else if (swing == "center")
-    this->cmd[4] = (this->cmd[4] & 0x0F) + 0x30;
-  else if (swing == "up_center")
-    this->cmd[4] = (this->cmd[4] & 0x0F) + 0x20;
-  else if (swing == "up")
-    this->cmd[4] = (this->cmd[4] & 0x0F) + 0x10;
-  else if (swing == "swing")
-    this->cmd[4] = (this->cmd[4] & 0x0F) + 0xE0;
-  else if (swing == "auto")
-    this->cmd[4] = (this->cmd[4] & 0x0F) + 0xF0;
-  else {
+  this->schedule_command();
+
+  const NamedValue *entry = find_name(VERTICAL_SWINGS, swing);
+
+  if (entry == nullptr) {
     ESP_LOGW(TAG, "Unsupported vertical swing position received");
     return;
   }
+
+  this->cmd.set_vertical_swing(entry->value);
+  this->stamp_changes();
 }
 
 void PanasonicACCNT::on_horizontal_swing_change(const StringRef &swing) {
-  if (this->state_ != ACState::Ready)
-    return;
-
   ESP_LOGD(TAG, "Setting horizontal swing position");
 
-  if (this->cmd.empty()) {
-    ESP_LOGV(TAG, "Copying data to cmd");
-    this->cmd = this->data;
-  }
-
-  if (swing == "left")
-    this->cmd[4] = (this->cmd[4] & 0xF0) + 0x09;
-  else if (swing == "left_center")
-    this->cmd[4] = (this->cmd[4] & 0xF0) + 0x0A;
-  else if (swing == "center")
-    this->cmd[4] = (this->cmd[4] & 0xF0) + 0x06;
-  else if (swing == "right_center")
-    this->cmd[4] = (this->cmd[4] & 0xF0) + 0x0B;
-  else if (swing == "right")
-    this->cmd[4] = (this->cmd[4] & 0xF0) + 0x0C;
-  else if (swing == "auto")
-    this->cmd[4] = (this->cmd[4] & 0xF0) + 0x0D;
-  else {
+  this->schedule_command();
+
+  const NamedValue *entry = find_name(HORIZONTAL_SWINGS, swing);
+
+  if (entry == nullptr) {
     ESP_LOGW(TAG, "Unsupported horizontal swing position received");
     return;
   }
+
+  this->cmd.set_horizontal_swing(entry->value);
+  this->stamp_changes();
 }
 
 void PanasonicACCNT::on_nanoex_change(bool state) {
-  if (this->state_ != ACState::Ready)
-    return;
-
-  if (this->cmd.empty()) {
-    ESP_LOGV(TAG, "Copying data to cmd");
-    this->cmd = this->data;
-  }
+  this->schedule_command();
 
   this->nanoex_state_ = state;
 
   if (state) {
     ESP_LOGV(TAG, "Turning nanoex on");
-    this->cmd[5] = (this->cmd[5] & 0x0F) + 0x40;
+    this->cmd.set_nanoex(true);
   } else {
     ESP_LOGV(TAG, "Turning nanoex off");
-    this->cmd[5] = (this->cmd[5] & 0x0F);
+    this->cmd.set_nanoex(false);
   }
+
+  this->stamp_changes();
 }
 
 void PanasonicACCNT::on_eco_change(bool state) {
-  if (this->state_ != ACState::Ready)
-    return;
-
-  if (this->cmd.empty()) {
-    ESP_LOGV(TAG, "Copying data to cmd");
-    this->cmd = this->data;
-  }
+  this->schedule_command();
 
   this->eco_state_ = state;
 
   if (state) {
     ESP_LOGV(TAG, "Turning eco mode on");
-    this->cmd[8] = 0x40;
+    this->cmd.set_eco(true);
   } else {
     ESP_LOGV(TAG, "Turning eco mode off");
-    this->cmd[8] = 0x00;
+    this->cmd.set_eco(false);
   }
+
+  this->stamp_changes();
 }
 
 void PanasonicACCNT::on_econavi_change(bool state) {
-  if (this->state_ != ACState::Ready)
-    return;
-
-  if (this->cmd.empty()) {
-    ESP_LOGV(TAG, "Copying data to cmd");
-    this->cmd = this->data;
-  }
+  this->schedule_command();
 
   this->econavi_state_ = state;
 
   if (state) {
     ESP_LOGV(TAG, "Turning econavi mode on");
-    this->cmd[5] = 0x10;
+    this->cmd.set_econavi(true);
   } else {
     ESP_LOGV(TAG, "Turning econavi mode off");
-    this->cmd[5] = 0x00;
+    this->cmd.set_econavi(false);
   }
+
+  this->stamp_changes();
 }
 
 void PanasonicACCNT::on_mild_dry_change(bool state) {
-  if (this->state_ != ACState::Ready)
-    return;
-
-  if (this->cmd.empty()) {
-    ESP_LOGV(TAG, "Copying data to cmd");
-    this->cmd = this->data;
-  }
+  this->schedule_command();
 
   this->mild_dry_state_ = state;
 
   if (state) {
     ESP_LOGV(TAG, "Turning mild dry on");
-    this->cmd[2] = 0x7F;
+    this->cmd.set_mild_dry(true);
   } else {
     ESP_LOGV(TAG, "Turning mild dry off");
-    this->cmd[2] = 0x80;
+    this->cmd.set_mild_dry(false);
   }
+
+  this->stamp_changes();
 }
 
 }  // namespace CNT
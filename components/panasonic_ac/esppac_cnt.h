@@ -1,32 +1,43 @@
+#pragma once
+
 #include "esphome/components/climate/climate.h"
 #include "esphome/components/climate/climate_mode.h"
 #include "esppac.h"
+#include "esppac_state_cnt.h"
 
 namespace esphome {
 namespace panasonic_ac {
 namespace CNT {
 
-static const uint8_t CTRL_HEADER = 0xF0;  // The header for control frames
-static const uint8_t POLL_HEADER = 0x70;  // The header for the poll command
-
 static const int POLL_INTERVAL = 5000;  // The interval at which to poll the AC
 static const int CMD_INTERVAL = 250;    // The interval at which to send commands
 
+// Bytes of the poll response following the state block that are decoded
+static const uint8_t SENSOR_OFFSETS[]{QUERY_DEFROST,
+                                      QUERY_CURRENT_TEMPERATURE,
+                                      QUERY_OUTSIDE_TEMPERATURE,
+                                      20,  // Marker
+                                      QUERY_CURRENT_TEMPERATURE_ALT,
+                                      QUERY_OUTSIDE_TEMPERATURE_ALT,
+                                      QUERY_POWER_CONSUMPTION,
+                                      QUERY_POWER_CONSUMPTION + 1,
+                                      QUERY_POWER_CONSUMPTION + 2};
+
 enum class ACState {
   Initializing,  // Before first query response is receive
   Ready,         // All done, ready to receive regular packets
 };
 
-class PanasonicACCNT : public PanasonicAC {
+class PanasonicACCNT : public PanasonicACDriver<PanasonicACCNT> {
  public:
   void control(const climate::ClimateCall &call) override;
 
-  void on_horizontal_swing_change(const StringRef &swing) override;
-  void on_vertical_swing_change(const StringRef &swing) override;
-  void on_nanoex_change(bool nanoex) override;
-  void on_eco_change(bool eco) override;
-  void on_econavi_change(bool eco) override;
-  void on_mild_dry_change(bool mild_dry) override;
+  void on_horizontal_swing_change(const StringRef &swing);
+  void on_vertical_swing_change(const StringRef &swing);
+  void on_nanoex_change(bool nanoex);
+  void on_eco_change(bool eco);
+  void on_econavi_change(bool eco);
+  void on_mild_dry_change(bool mild_dry);
 
   void setup() override;
   void loop() override;
@@ -34,20 +45,31 @@ class PanasonicACCNT : public PanasonicAC {
  protected:
   ACState state_ = ACState::Initializing;  // Stores the internal state of the AC, used during initialization
 
-  // uint8_t data[10];
-  std::vector<uint8_t> data = std::vector<uint8_t>(10);  // Stores the data received from the AC
-  std::vector<uint8_t> cmd;                              // Used to build next command
+  State data{};   // Stores the data received from the AC
+  Command cmd{};  // Fields changed since the last command, merged into data when sent
+
+  uint8_t sensor_cache_[sizeof(SENSOR_OFFSETS)];  // Sensor bytes of the last poll response
+  size_t sensor_cache_length_ = 0;                // Length of the last poll response
+  bool poll_cache_valid_ = false;                 // Set to false to force decoding the next poll response
+  uint32_t field_changed_[FIELD_COUNT];           // Time of the last change of every field of cmd, see FIELDS
 
   void handle_poll();
   void handle_cmd();
+  void stamp_changes();
+  bool expire_changes();
 
-  void set_data(bool set);
+  void set_data();
+  void set_sensor_data(FrameView frame);
+  bool update_sensor_cache(FrameView frame);
 
-  void send_command(std::vector<uint8_t> command, CommandType type, uint8_t header);
+  void send_command(const uint8_t *command, size_t length, CommandType type, uint8_t header);
   void send_packet(const std::vector<uint8_t> &command, CommandType type);
 
   bool verify_packet();
   void handle_packet();
+#ifdef USE_PANASONIC_AC_PASSIVE
+  void handle_controller_packet();
+#endif
 };
 
 }  // namespace CNT
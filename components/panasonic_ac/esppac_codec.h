@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "esppac_frame_view.h"
+
+// Frame encoding and validation of both protocols, kept free of ESPHome dependencies
+
+namespace esphome {
+namespace panasonic_ac {
+
+enum class FrameError : uint8_t {
+  None,
+  Length,          // Too short to be a frame
+  Header,          // Unknown header
+  LengthMismatch,  // Length byte does not match the frame size
+  Checksum,        // Bytes do not add up to zero
+};
+
+inline const char *frame_error_to_string(FrameError error) {
+  switch (error) {
+    case FrameError::None:
+      return "none";
+    case FrameError::Length:
+      return "length";
+    case FrameError::Header:
+      return "header";
+    case FrameError::LengthMismatch:
+      return "length mismatch";
+    case FrameError::Checksum:
+      return "checksum";
+    default:
+      return "unknown";
+  }
+}
+
+// Both protocols append a checksum so that all bytes of a valid frame add up to zero
+constexpr uint8_t sum_bytes(const uint8_t *data, size_t length) {
+  uint8_t sum = 0;
+
+  for (size_t i = 0; i < length; i++)
+    sum += data[i];
+
+  return sum;
+}
+
+constexpr uint8_t checksum_for(const uint8_t *data, size_t length) { return -sum_bytes(data, length); }
+
+namespace CNT {
+
+static const uint8_t CTRL_HEADER = 0xF0;  // The header for control frames
+static const uint8_t POLL_HEADER = 0x70;  // The header for the poll command
+
+static const uint8_t MIN_FRAME_SIZE = 12;  // Header, length, state block and checksum
+static const uint8_t FRAME_OVERHEAD = 3;   // Header, length and checksum
+
+/*
+ * Write header, length, payload and checksum to out, which must hold length + FRAME_OVERHEAD bytes
+ */
+constexpr size_t encode_frame(uint8_t header, const uint8_t *payload, uint8_t length, uint8_t *out) {
+  out[0] = header;
+  out[1] = length;
+
+  for (size_t i = 0; i < length; i++)
+    out[i + 2] = payload[i];
+
+  out[length + 2] = checksum_for(out, length + 2);
+
+  return length + FRAME_OVERHEAD;
+}
+
+constexpr FrameError check_frame(FrameView frame) {
+  if (frame.size() < MIN_FRAME_SIZE)
+    return FrameError::Length;
+
+  if (frame[0] != CTRL_HEADER && frame[0] != POLL_HEADER)
+    return FrameError::Header;
+
+  if (frame[1] != frame.size() - FRAME_OVERHEAD)
+    return FrameError::LengthMismatch;
+
+  if (sum_bytes(frame.data(), frame.size()) != 0)
+    return FrameError::Checksum;
+
+  return FrameError::None;
+}
+
+}  // namespace CNT
+
+namespace WLAN {
+
+static const uint8_t HEADER = 0x5A;       // The header of the protocol, every packet starts with this
+static const uint8_t SYNC_HEADER = 0x66;  // Sync packets are the only packets not starting with HEADER
+
+static const uint8_t MIN_FRAME_SIZE = 5;  // Header, counter, type and checksum
+
+/*
+ * Write header, packet counter and checksum into a frame whose payload starts at index 2
+ */
+constexpr void seal_frame(uint8_t *frame, size_t length, uint8_t counter) {
+  frame[0] = HEADER;
+  frame[1] = counter;
+  frame[length - 1] = checksum_for(frame, length - 1);
+}
+
+// Packet counters skip 0x00 and 0xFF, they roll over from 0xFE to 0x01
+constexpr uint8_t next_counter(uint8_t counter) { return counter == 0xFE ? 0x01 : counter + 1; }
+
+constexpr FrameError check_frame(FrameView frame) {
+  if (frame.size() < MIN_FRAME_SIZE)
+    return FrameError::Length;
+
+  if (frame[0] != HEADER)
+    return FrameError::Header;
+
+  if (sum_bytes(frame.data(), frame.size()) != 0)
+    return FrameError::Checksum;
+
+  return FrameError::None;
+}
+
+}  // namespace WLAN
+
+}  // namespace panasonic_ac
+}  // namespace esphome
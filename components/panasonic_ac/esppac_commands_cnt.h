@@ -1,4 +1,6 @@
-#include <vector>
+#pragma once
+
+#include <cstdint>
 
 namespace esphome {
 namespace panasonic_ac {
@@ -8,7 +10,7 @@ namespace CNT {
  * Poll command
  */
 
-static const std::vector<uint8_t> CMD_POLL = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+static constexpr uint8_t CMD_POLL[]{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
 /*
  * Control command
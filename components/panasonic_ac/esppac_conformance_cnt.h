@@ -0,0 +1,215 @@
+#pragma once
+
+#include "esppac_codec.h"
+#include "esppac_commands_cnt.h"
+#include "esppac_registers_cnt.h"
+#include "esppac_state_cnt.h"
+
+// Frames documented in protocol/cztacg1/protocol_description_query.ods, checked against the codec and the decoder
+// at compile time so changes to either cannot silently drift away from the documented layout. The round trips below
+// do the same for the register tables, the command encoding and the state decoding together.
+
+namespace esphome {
+namespace panasonic_ac {
+namespace CNT {
+namespace conformance {
+
+static constexpr uint8_t QUERY_REQUEST[]{0x70, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                         0x00, 0x00, 0x00, 0x00, 0x00, 0x86};
+
+// Cool at 21.5 °C, fan speed 3, swing up/left, nanoeX on, 22 °C inside and 25 °C outside
+static constexpr uint8_t QUERY_RESPONSE[]{0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x19, 0x40, 0x00, 0x40, 0x00, 0x00,
+                                          0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF,
+                                          0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x8C};
+
+constexpr bool encodes_query_request() {
+  uint8_t frame[sizeof(QUERY_REQUEST)]{};
+
+  if (encode_frame(POLL_HEADER, CMD_POLL, sizeof(CMD_POLL), frame) != sizeof(QUERY_REQUEST))
+    return false;
+
+  for (size_t i = 0; i < sizeof(QUERY_REQUEST); i++) {
+    if (frame[i] != QUERY_REQUEST[i])
+      return false;
+  }
+
+  return true;
+}
+
+constexpr State RESPONSE_STATE = load_state(QUERY_RESPONSE + QUERY_STATE);
+
+static_assert(encodes_query_request(), "Poll request does not match the documented frame");
+static_assert(check_frame(FrameView(QUERY_REQUEST, sizeof(QUERY_REQUEST))) == FrameError::None,
+              "Documented poll request is rejected");
+static_assert(check_frame(FrameView(QUERY_RESPONSE, sizeof(QUERY_RESPONSE))) == FrameError::None,
+              "Documented poll response is rejected");
+
+static_assert(RESPONSE_STATE.power() && RESPONSE_STATE.mode() == MODE_COOL, "Mode decoded incorrectly");
+static_assert(RESPONSE_STATE.target_temperature() == 43, "Target temperature decoded incorrectly");
+static_assert(RESPONSE_STATE.mild_dry() == MILD_DRY_OFF, "Mild dry decoded incorrectly");
+static_assert(RESPONSE_STATE.fan_speed() == FAN_SPEED_3, "Fan speed decoded incorrectly");
+static_assert(RESPONSE_STATE.vertical_swing() == VERTICAL_SWING_UP, "Vertical swing decoded incorrectly");
+static_assert(RESPONSE_STATE.horizontal_swing() == HORIZONTAL_SWING_LEFT, "Horizontal swing decoded incorrectly");
+static_assert(RESPONSE_STATE.preset() == PRESET_NORMAL && RESPONSE_STATE.nanoex() && !RESPONSE_STATE.econavi(),
+              "Preset byte decoded incorrectly");
+static_assert(RESPONSE_STATE.eco() == ECO_OFF, "Eco decoded incorrectly");
+
+static_assert(QUERY_RESPONSE[QUERY_CURRENT_TEMPERATURE] == 22 && QUERY_RESPONSE[QUERY_OUTSIDE_TEMPERATURE] == 25,
+              "Temperature offsets do not match the documented frame");
+static_assert(QUERY_RESPONSE[QUERY_DEFROST] != DEFROST_ON, "Defrost offset does not match the documented frame");
+static_assert(determine_power_consumption(QUERY_RESPONSE[QUERY_POWER_CONSUMPTION],
+                                          QUERY_RESPONSE[QUERY_POWER_CONSUMPTION + 1],
+                                          QUERY_RESPONSE[QUERY_POWER_CONSUMPTION + 2]) == 567,
+              "Power consumption decoded incorrectly");
+
+/*
+ * Round trips: every table entry a command can write must decode back to the same entry and must not touch any
+ * other field
+ */
+
+constexpr State filled_state(uint8_t value) {
+  State state{};
+
+  for (uint8_t i = 0; i < STATE_SIZE; i++)
+    state.raw[i] = value;
+
+  return state;
+}
+
+// Commands are applied on top of these states
+static constexpr State BACKGROUNDS[]{filled_state(0x00), filled_state(0xFF), RESPONSE_STATE};
+
+constexpr bool only_field_changed(const State &before, const State &after, Field field) {
+  for (uint8_t i = 0; i < STATE_SIZE; i++) {
+    uint8_t mask = i == field.index ? field.mask : 0;
+
+    if ((before.raw[i] & ~mask) != (after.raw[i] & ~mask))
+      return false;
+  }
+
+  return true;
+}
+
+// Option name -> value -> command -> state -> option name, as a select or custom mode would go through the driver
+template<size_t N> constexpr bool names_round_trip(Field field, const NamedValue (&table)[N]) {
+  for (const State &background : BACKGROUNDS) {
+    for (const NamedValue &entry : table) {
+      const NamedValue *encoded = find_name(table, entry.name);
+
+      if (encoded == nullptr)
+        return false;
+
+      Command command{};
+      command.set(field, encoded->value);
+      State result = command.apply(background);
+      const NamedValue *decoded = find_value(table, result.get(field));
+
+      if (decoded == nullptr || !names_equal(decoded->name, entry.name) ||
+          !only_field_changed(background, result, field))
+        return false;
+    }
+  }
+
+  return true;
+}
+
+constexpr bool modes_round_trip() {
+  for (const State &background : BACKGROUNDS) {
+    for (const ModeValue &entry : MODES) {
+      const ModeValue *encoded = find_mode(MODES, entry.mode);
+
+      if (encoded == nullptr)
+        return false;
+
+      Command command{};
+      command.set_mode(encoded->value);
+      State result = command.apply(background);
+      const ModeValue *decoded = find_value(MODES, result.mode());
+
+      if (decoded == nullptr || decoded->mode != entry.mode || !only_field_changed(background, result, FIELD_MODE))
+        return false;
+    }
+  }
+
+  return true;
+}
+
+constexpr bool swing_modes_round_trip() {
+  constexpr Field swing_byte{FIELD_VERTICAL_SWING.index, FIELD_VERTICAL_SWING.mask | FIELD_HORIZONTAL_SWING.mask};
+
+  for (const State &background : BACKGROUNDS) {
+    for (const SwingPair &entry : SWING_MODES) {
+      const SwingPair *encoded = find_swing_pair(SWING_MODES, entry.swing);
+
+      if (encoded == nullptr)
+        return false;
+
+      Command command{};
+      command.set_vertical_swing(encoded->vertical);
+      command.set_horizontal_swing(encoded->horizontal);
+      State result = command.apply(background);
+
+      if (determine_swing(result.vertical_swing(), result.horizontal_swing()) != entry.swing ||
+          !only_field_changed(background, result, swing_byte))
+        return false;
+    }
+  }
+
+  return true;
+}
+
+template<size_t N> constexpr bool temperatures_round_trip(const uint8_t (&temperatures)[N]) {
+  for (const State &background : BACKGROUNDS) {
+    for (uint8_t temperature : temperatures) {
+      Command command{};
+      command.set_target_temperature(temperature);
+      State result = command.apply(background);
+
+      if (result.target_temperature() != temperature ||
+          !only_field_changed(background, result, FIELD_TARGET_TEMPERATURE))
+        return false;
+    }
+  }
+
+  return true;
+}
+
+constexpr bool flags_round_trip() {
+  for (const State &background : BACKGROUNDS) {
+    for (bool on : {false, true}) {
+      Command command{};
+      command.set_power(on);
+      command.set_nanoex(on);
+      command.set_econavi(on);
+      command.set_mild_dry(on);
+      command.set_eco(on);
+      State result = command.apply(background);
+
+      if (result.power() != on || result.nanoex() != on || result.econavi() != on ||
+          result.mild_dry() != (on ? MILD_DRY_ON : MILD_DRY_OFF) || result.eco() != (on ? ECO_ON : ECO_OFF))
+        return false;
+
+      // Preset shares its byte with nanoeX and econavi
+      if (result.preset() != background.preset())
+        return false;
+    }
+  }
+
+  return true;
+}
+
+static constexpr uint8_t TARGET_TEMPERATURES[]{32, 43, 60};  // 16 °C, 21.5 °C and 30 °C
+
+static_assert(modes_round_trip(), "Mode does not round trip");
+static_assert(names_round_trip(FIELD_FAN_SPEED, FAN_SPEEDS), "Fan speed does not round trip");
+static_assert(names_round_trip(FIELD_VERTICAL_SWING, VERTICAL_SWINGS), "Vertical swing does not round trip");
+static_assert(names_round_trip(FIELD_HORIZONTAL_SWING, HORIZONTAL_SWINGS), "Horizontal swing does not round trip");
+static_assert(names_round_trip(FIELD_PRESET, PRESETS), "Preset does not round trip");
+static_assert(swing_modes_round_trip(), "Swing mode does not round trip");
+static_assert(temperatures_round_trip(TARGET_TEMPERATURES), "Target temperature does not round trip");
+static_assert(flags_round_trip(), "Power, nanoeX, econavi, mild dry or eco do not round trip");
+
+}  // namespace conformance
+}  // namespace CNT
+}  // namespace panasonic_ac
+}  // namespace esphome
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace panasonic_ac {
+
+/*
+ * A complete frame as received by the RX task
+ */
+template<size_t Size> struct ReceivedFrame {
+  uint32_t timestamp;  // Time in microseconds at which the last byte of the frame was received
+  uint8_t length;      // Number of valid bytes in data
+  uint8_t data[Size];
+};
+
+/*
+ * Lock-free single-producer/single-consumer ring of frames
+ *
+ * The producer fills the slot returned by acquire() in place and hands it over with commit(), the consumer reads the
+ * slot returned by peek() and releases it with pop(). Only std::atomic is used, so the same queue works with a
+ * FreeRTOS task on the ESP32 and with std::thread on the host.
+ */
+template<size_t Capacity, size_t Size> class FrameQueue {
+  static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+  static_assert(Capacity <= 128, "Capacity must fit the 8 bit indices");
+
+ public:
+  // Producer side
+  ReceivedFrame<Size> *acquire() {
+    uint8_t head = this->head_.load(std::memory_order_relaxed);
+
+    if ((uint8_t) (head - this->tail_.load(std::memory_order_acquire)) == Capacity)
+      return nullptr;  // Full
+
+    return &this->frames_[head & (Capacity - 1)];
+  }
+
+  void commit() { this->head_.store(this->head_.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+  // Consumer side
+  const ReceivedFrame<Size> *peek() const {
+    uint8_t tail = this->tail_.load(std::memory_order_relaxed);
+
+    if (tail == this->head_.load(std::memory_order_acquire))
+      return nullptr;  // Empty
+
+    return &this->frames_[tail & (Capacity - 1)];
+  }
+
+  void pop() { this->tail_.store(this->tail_.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+  bool empty() const {
+    return this->tail_.load(std::memory_order_relaxed) == this->head_.load(std::memory_order_acquire);
+  }
+
+ protected:
+  std::atomic<uint8_t> head_{0};  // Next slot to be written, only modified by the producer
+  std::atomic<uint8_t> tail_{0};  // Next slot to be read, only modified by the consumer
+  ReceivedFrame<Size> frames_[Capacity];
+};
+
+}  // namespace panasonic_ac
+}  // namespace esphome
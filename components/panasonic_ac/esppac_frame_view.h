@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace esphome {
+namespace panasonic_ac {
+
+/*
+ * Non-owning, read-only view of a received frame used by the decoders
+ *
+ * Decoders check the range they are about to read once with has() and then index with operator[], which is as cheap
+ * as indexing the buffer directly. Single optional bytes are read with get(), which returns a fallback if the frame
+ * is too short.
+ */
+class FrameView {
+ public:
+  constexpr FrameView(const uint8_t *data, size_t size) : data_(data), size_(size) {}
+  FrameView(const std::vector<uint8_t> &data) : data_(data.data()), size_(data.size()) {}
+
+  constexpr const uint8_t *data() const { return this->data_; }
+  constexpr size_t size() const { return this->size_; }
+
+  // Returns true if the frame contains length bytes starting at index
+  constexpr bool has(size_t index, size_t length = 1) const {
+    return index <= this->size_ && length <= this->size_ - index;
+  }
+
+  // Unchecked access, only valid after has() confirmed the range
+  constexpr uint8_t operator[](size_t index) const { return this->data_[index]; }
+
+  // Checked access, returns fallback if the frame is too short
+  constexpr uint8_t get(size_t index, uint8_t fallback = 0) const {
+    return index < this->size_ ? this->data_[index] : fallback;
+  }
+
+ protected:
+  const uint8_t *data_;
+  size_t size_;
+};
+
+}  // namespace panasonic_ac
+}  // namespace esphome
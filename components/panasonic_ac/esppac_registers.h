@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "esphome/components/climate/climate_mode.h"
+
+// Value table entries and lookups shared by the register tables of both protocols, see esppac_registers_cnt.h and
+// esppac_registers_wlan.h
+
+namespace esphome {
+namespace panasonic_ac {
+
+/*
+ * Entries of the value tables
+ */
+
+struct NamedValue {
+  uint8_t value;
+  const char *name;  // Option as used by the custom fan modes, presets and swing selects
+};
+
+struct ModeValue {
+  uint8_t value;
+  climate::ClimateMode mode;
+};
+
+struct SwingValue {
+  uint8_t value;
+  climate::ClimateSwingMode swing;
+};
+
+/*
+ * Lookups, return nullptr if the table has no matching entry
+ */
+
+template<typename T, size_t N> constexpr const T *find_value(const T (&table)[N], uint8_t value) {
+  for (const T &entry : table) {
+    if (entry.value == value)
+      return &entry;
+  }
+
+  return nullptr;
+}
+
+constexpr bool names_equal(const char *a, const char *b) {
+  while (*a != '\0' && *a == *b) {
+    a++;
+    b++;
+  }
+
+  return *a == *b;
+}
+
+template<typename S> bool names_equal(const S &a, const char *b) { return a == b; }  // StringRef and std::string
+
+template<size_t N, typename S> constexpr const NamedValue *find_name(const NamedValue (&table)[N], const S &name) {
+  for (const NamedValue &entry : table) {
+    if (names_equal(name, entry.name))
+      return &entry;
+  }
+
+  return nullptr;
+}
+
+template<size_t N> constexpr const ModeValue *find_mode(const ModeValue (&table)[N], climate::ClimateMode mode) {
+  for (const ModeValue &entry : table) {
+    if (entry.mode == mode)
+      return &entry;
+  }
+
+  return nullptr;
+}
+
+template<size_t N>
+constexpr const SwingValue *find_swing(const SwingValue (&table)[N], climate::ClimateSwingMode swing) {
+  for (const SwingValue &entry : table) {
+    if (entry.swing == swing)
+      return &entry;
+  }
+
+  return nullptr;
+}
+
+/*
+ * Every entry must be found again by its value, which rules out duplicate values that would not round trip
+ */
+
+template<typename T, size_t N> constexpr bool contains_value(const T (&table)[N], uint8_t value) {
+  for (const T &entry : table) {
+    if (entry.value == value)
+      return true;
+  }
+
+  return false;
+}
+
+template<typename T, size_t N> constexpr bool values_round_trip(const T (&table)[N]) {
+  for (const T &entry : table) {
+    if (find_value(table, entry.value) != &entry)
+      return false;
+  }
+
+  return true;
+}
+
+}  // namespace panasonic_ac
+}  // namespace esphome
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstdint>
+
+#include "esppac_registers.h"
+#include "esppac_state_cnt.h"
+
+// Values of the CN-CNT state block fields and the climate modes, options and presets they stand for. Encoding and
+// decoding both look up the same tables, so a value can only be added or changed in one place. The field layout and
+// the raw values are in esppac_state_cnt.h.
+
+namespace esphome {
+namespace panasonic_ac {
+namespace CNT {
+
+/*
+ * Swing mode as a pair of swing positions, the climate swing mode is derived from the axes set to auto
+ */
+struct SwingPair {
+  climate::ClimateSwingMode swing;
+  uint8_t vertical;
+  uint8_t horizontal;
+};
+
+static constexpr ModeValue MODES[]{
+    {MODE_AUTO, climate::CLIMATE_MODE_HEAT_COOL}, {MODE_COOL, climate::CLIMATE_MODE_COOL},
+    {MODE_HEAT, climate::CLIMATE_MODE_HEAT},      {MODE_DRY, climate::CLIMATE_MODE_DRY},
+    {MODE_FAN_ONLY, climate::CLIMATE_MODE_FAN_ONLY},
+};
+
+static constexpr NamedValue FAN_SPEEDS[]{
+    {FAN_SPEED_AUTO, "Automatic"}, {FAN_SPEED_1, "1"}, {FAN_SPEED_2, "2"},
+    {FAN_SPEED_3, "3"},            {FAN_SPEED_4, "4"}, {FAN_SPEED_5, "5"},
+};
+
+static constexpr NamedValue PRESETS[]{
+    {PRESET_NORMAL, "Normal"},
+    {PRESET_POWERFUL, "Powerful"},
+    {PRESET_QUIET, "Quiet"},
+};
+
+static constexpr NamedValue VERTICAL_SWINGS[]{
+    {VERTICAL_SWING_SWING, "swing"},         {VERTICAL_SWING_AUTO, "auto"},
+    {VERTICAL_SWING_UP, "up"},               {VERTICAL_SWING_UP_CENTER, "up_center"},
+    {VERTICAL_SWING_CENTER, "center"},       {VERTICAL_SWING_DOWN_CENTER, "down_center"},
+    {VERTICAL_SWING_DOWN, "down"},
+};
+
+static constexpr NamedValue HORIZONTAL_SWINGS[]{
+    {HORIZONTAL_SWING_AUTO, "auto"},     {HORIZONTAL_SWING_LEFT, "left"},
+    {HORIZONTAL_SWING_LEFT_CENTER, "left_center"}, {HORIZONTAL_SWING_CENTER, "center"},
+    {HORIZONTAL_SWING_RIGHT_CENTER, "right_center"}, {HORIZONTAL_SWING_RIGHT, "right"},
+};
+
+// Axes that stop swinging are reset to center
+static constexpr SwingPair SWING_MODES[]{
+    {climate::CLIMATE_SWING_BOTH, VERTICAL_SWING_AUTO, HORIZONTAL_SWING_AUTO},
+    {climate::CLIMATE_SWING_OFF, VERTICAL_SWING_CENTER, HORIZONTAL_SWING_CENTER},
+    {climate::CLIMATE_SWING_VERTICAL, VERTICAL_SWING_AUTO, HORIZONTAL_SWING_CENTER},
+    {climate::CLIMATE_SWING_HORIZONTAL, VERTICAL_SWING_CENTER, HORIZONTAL_SWING_AUTO},
+};
+
+static const char *const SWING_UNSUPPORTED = "unsupported";  // Option reported for an axis the AC does not have
+
+template<size_t N>
+constexpr const SwingPair *find_swing_pair(const SwingPair (&table)[N], climate::ClimateSwingMode swing) {
+  for (const SwingPair &entry : table) {
+    if (entry.swing == swing)
+      return &entry;
+  }
+
+  return nullptr;
+}
+
+constexpr climate::ClimateSwingMode determine_swing(uint8_t vertical, uint8_t horizontal) {
+  bool vertical_auto = vertical == VERTICAL_SWING_AUTO;
+  bool horizontal_auto = horizontal == HORIZONTAL_SWING_AUTO;
+
+  if (vertical_auto && horizontal_auto)
+    return climate::CLIMATE_SWING_BOTH;
+  if (vertical_auto)
+    return climate::CLIMATE_SWING_VERTICAL;
+  if (horizontal_auto)
+    return climate::CLIMATE_SWING_HORIZONTAL;
+
+  return climate::CLIMATE_SWING_OFF;
+}
+
+// Every swing mode must be decoded again from the positions it is encoded to
+template<size_t N> constexpr bool swing_pairs_round_trip(const SwingPair (&table)[N]) {
+  for (const SwingPair &entry : table) {
+    if (determine_swing(entry.vertical, entry.horizontal) != entry.swing)
+      return false;
+  }
+
+  return true;
+}
+
+static_assert(values_round_trip(MODES), "Duplicate mode value");
+static_assert(values_round_trip(FAN_SPEEDS), "Duplicate fan speed value");
+static_assert(values_round_trip(PRESETS), "Duplicate preset value");
+static_assert(values_round_trip(VERTICAL_SWINGS), "Duplicate vertical swing value");
+static_assert(values_round_trip(HORIZONTAL_SWINGS), "Duplicate horizontal swing value");
+static_assert(!contains_value(VERTICAL_SWINGS, VERTICAL_SWING_UNSUPPORTED) &&
+                  !contains_value(HORIZONTAL_SWINGS, HORIZONTAL_SWING_UNSUPPORTED),
+              "Unsupported swing must not be selectable");
+static_assert(swing_pairs_round_trip(SWING_MODES), "Swing mode does not round trip");
+
+}  // namespace CNT
+}  // namespace panasonic_ac
+}  // namespace esphome
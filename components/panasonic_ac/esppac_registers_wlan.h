@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+
+#include "esppac_registers.h"
+
+// Keys and values of the key/value pairs in CN-WLAN set commands, query responses and reports. Encoding and decoding
+// both look up the same tables, so a value can only be added or changed in one place.
+
+namespace esphome {
+namespace panasonic_ac {
+namespace WLAN {
+
+static const uint8_t KEY_POWER = 0x80;
+static const uint8_t KEY_MODE = 0xB0;
+static const uint8_t KEY_TARGET_TEMPERATURE = 0x31;  // Target temperature / TEMPERATURE_STEP
+static const uint8_t KEY_FAN_SPEED = 0xA0;
+static const uint8_t KEY_PRESET = 0xB2;
+static const uint8_t KEY_SWING_MODE = 0xA1;
+static const uint8_t KEY_VERTICAL_SWING = 0xA4;
+static const uint8_t KEY_HORIZONTAL_SWING = 0xA5;
+static const uint8_t KEY_NANOEX = 0x33;
+static const uint8_t KEY_NANOEX_UNKNOWN = 0x20;  // Reported next to nanoeX, meaning unknown
+static const uint8_t KEY_UNKNOWN_34 = 0x34;      // Reset together with the preset, meaning unknown
+static const uint8_t KEY_UNKNOWN_35 = 0x35;      // Reset together with the preset and swing, meaning unknown
+
+static const uint8_t POWER_ON = 0x30;
+static const uint8_t POWER_OFF = 0x31;
+
+static const uint8_t VALUE_ON = 0x45;   // Used by nanoeX
+static const uint8_t VALUE_OFF = 0x42;  // Used by nanoeX and the unknown keys
+
+static const uint8_t PRESET_NORMAL = 0x41;
+
+static constexpr ModeValue MODES[]{
+    {0x41, climate::CLIMATE_MODE_HEAT_COOL}, {0x42, climate::CLIMATE_MODE_COOL},
+    {0x43, climate::CLIMATE_MODE_HEAT},      {0x44, climate::CLIMATE_MODE_DRY},
+    {0x45, climate::CLIMATE_MODE_FAN_ONLY},
+};
+
+static constexpr NamedValue FAN_SPEEDS[]{
+    {0x41, "Automatic"}, {0x32, "1"}, {0x33, "2"}, {0x34, "3"}, {0x35, "4"}, {0x36, "5"},
+};
+
+static constexpr NamedValue PRESETS[]{
+    {PRESET_NORMAL, "Normal"},
+    {0x42, "Powerful"},
+    {0x43, "Quiet"},
+};
+
+static constexpr SwingValue SWING_MODES[]{
+    {0x41, climate::CLIMATE_SWING_BOTH},
+    {0x42, climate::CLIMATE_SWING_OFF},
+    {0x43, climate::CLIMATE_SWING_VERTICAL},
+    {0x44, climate::CLIMATE_SWING_HORIZONTAL},
+};
+
+static constexpr NamedValue VERTICAL_SWINGS[]{
+    {0x41, "up"}, {0x44, "up_center"}, {0x43, "center"}, {0x45, "down_center"}, {0x42, "down"},
+};
+
+static constexpr NamedValue HORIZONTAL_SWINGS[]{
+    {0x42, "left"}, {0x5C, "left_center"}, {0x43, "center"}, {0x56, "right_center"}, {0x41, "right"},
+};
+
+static const uint8_t SWING_CENTER = 0x43;  // Center position of both swing axes
+
+static_assert(values_round_trip(MODES), "Duplicate mode value");
+static_assert(values_round_trip(FAN_SPEEDS), "Duplicate fan speed value");
+static_assert(values_round_trip(PRESETS), "Duplicate preset value");
+static_assert(values_round_trip(SWING_MODES), "Duplicate swing mode value");
+static_assert(values_round_trip(VERTICAL_SWINGS), "Duplicate vertical swing value");
+static_assert(values_round_trip(HORIZONTAL_SWINGS), "Duplicate horizontal swing value");
+static_assert(contains_value(VERTICAL_SWINGS, SWING_CENTER) && contains_value(HORIZONTAL_SWINGS, SWING_CENTER),
+              "Swing center must be a valid position on both axes");
+
+}  // namespace WLAN
+}  // namespace panasonic_ac
+}  // namespace esphome
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Protocol timing of both drivers, kept free of ESPHome dependencies. The current time is always passed in, so the
+// same code runs against millis() on the ESP and against a simulated clock on the host.
+
+namespace esphome {
+namespace panasonic_ac {
+
+/*
+ * Deadlines of a fixed set of timers, identified by an enum class with Count entries
+ *
+ * All comparisons are done on the signed difference of two times, so they stay valid across the 49 day wrap around of
+ * a 32 bit millisecond clock as long as no deadline is more than 24 days away.
+ */
+template<typename Id, size_t Count> class TimerTable {
+  static_assert(Count <= 16, "Timers must fit the 16 bit mask");
+
+ public:
+  // Arms timer to fire delay ms after start, start may lie in the past or the future
+  void arm(Id timer, uint32_t now, uint32_t start, uint32_t delay) {
+    // Deadlines that already passed are due immediately, this keeps the signed comparisons valid
+    int32_t elapsed = (int32_t) (now - start);
+    this->deadlines_[(size_t) timer] = elapsed >= 0 && (uint32_t) elapsed >= delay ? now : start + delay;
+    this->armed_ |= bit(timer);
+
+    this->update_next_deadline();
+  }
+
+  void cancel(Id timer) {
+    if ((this->armed_ & bit(timer)) == 0)
+      return;
+
+    this->armed_ &= ~bit(timer);
+
+    this->update_next_deadline();
+  }
+
+  bool is_armed(Id timer) const { return (this->armed_ & bit(timer)) != 0; }
+
+  bool is_due(Id timer, uint32_t now) const {
+    return this->is_armed(timer) && (int32_t) (now - this->deadlines_[(size_t) timer]) >= 0;
+  }
+
+  // Returns true if at least one timer is due
+  bool any_due(uint32_t now) const { return this->armed_ != 0 && (int32_t) (now - this->next_deadline_) >= 0; }
+
+  // Time in ms until the earliest timer is due, UINT32_MAX if none is armed
+  uint32_t time_to_next(uint32_t now) const {
+    if (this->armed_ == 0)
+      return UINT32_MAX;
+
+    int32_t remaining = (int32_t) (this->next_deadline_ - now);
+    return remaining > 0 ? remaining : 0;
+  }
+
+ protected:
+  uint32_t deadlines_[Count];   // Stores the deadline of every armed timer
+  uint16_t armed_ = 0;          // Bit mask of the armed timers
+  uint32_t next_deadline_ = 0;  // Earliest deadline of all armed timers
+
+  static constexpr uint16_t bit(Id timer) { return 1 << (size_t) timer; }
+
+  void update_next_deadline() {
+    bool first = true;
+
+    for (size_t i = 0; i < Count; i++) {
+      if ((this->armed_ & (1 << i)) == 0)
+        continue;
+
+      if (first || (int32_t) (this->deadlines_[i] - this->next_deadline_) < 0)
+        this->next_deadline_ = this->deadlines_[i];
+
+      first = false;
+    }
+  }
+};
+
+/*
+ * Time to wait before sending a pending command: the debounce after the latest change, but never more than max_delay
+ * after the first change
+ */
+constexpr uint32_t command_delay(uint32_t now, uint32_t first_change, uint32_t debounce, uint32_t max_delay) {
+  uint32_t elapsed = now - first_change < max_delay ? now - first_change : max_delay;
+  uint32_t remaining = max_delay - elapsed;
+
+  return debounce < remaining ? debounce : remaining;
+}
+
+static_assert(command_delay(1000, 1000, 250, 1000) == 250, "First change waits the debounce");
+static_assert(command_delay(1900, 1000, 250, 1000) == 100, "Later changes are capped by the maximum delay");
+static_assert(command_delay(5000, 1000, 250, 1000) == 0, "Overdue commands are sent right away");
+static_assert(command_delay(100, UINT32_MAX - 99, 250, 1000) == 250, "Clock wrap around");
+
+}  // namespace panasonic_ac
+}  // namespace esphome
@@ -0,0 +1,227 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace esphome {
+namespace panasonic_ac {
+namespace CNT {
+
+static const uint8_t STATE_SIZE = 10;  // Size of the state block in poll responses and control frames
+
+// Offsets in the poll response frame, see protocol/cztacg1/protocol_description_query.ods
+static const uint8_t QUERY_STATE = 2;                     // Start of the state block
+static const uint8_t QUERY_DEFROST = 14;                  // 0x02 while defrosting
+static const uint8_t QUERY_CURRENT_TEMPERATURE = 18;      // Inside temperature
+static const uint8_t QUERY_OUTSIDE_TEMPERATURE = 19;
+static const uint8_t QUERY_CURRENT_TEMPERATURE_ALT = 21;  // Used if QUERY_CURRENT_TEMPERATURE is not supported
+static const uint8_t QUERY_OUTSIDE_TEMPERATURE_ALT = 22;  // Used if QUERY_OUTSIDE_TEMPERATURE is not supported
+static const uint8_t QUERY_POWER_CONSUMPTION = 28;        // Low byte, high byte and offset
+
+static const uint8_t TEMPERATURE_NOT_SUPPORTED = 0x80;  // Reported instead of a temperature the AC does not measure
+static const uint8_t DEFROST_ON = 0x02;
+
+/*
+ * Location of a field inside the state block, values are kept in place (not shifted)
+ */
+struct Field {
+  uint8_t index;  // Byte in the state block
+  uint8_t mask;   // Bits used by the field
+};
+
+static constexpr Field FIELD_POWER{0, 0x0F};               // Right nib of byte 0
+static constexpr Field FIELD_MODE{0, 0xF0};                // Left nib of byte 0
+static constexpr Field FIELD_TARGET_TEMPERATURE{1, 0xFF};  // Target temperature * 2
+static constexpr Field FIELD_MILD_DRY{2, 0xFF};
+static constexpr Field FIELD_FAN_SPEED{3, 0xFF};
+static constexpr Field FIELD_VERTICAL_SWING{4, 0xF0};      // Left nib of byte 4
+static constexpr Field FIELD_HORIZONTAL_SWING{4, 0x0F};    // Right nib of byte 4
+static constexpr Field FIELD_PRESET{5, 0x0F};              // Right nib of byte 5
+static constexpr Field FIELD_NANOEX{5, 0x40};
+static constexpr Field FIELD_ECONAVI{5, 0x10};
+static constexpr Field FIELD_ECO{8, 0xFF};
+
+// All fields, the position in this table identifies a field where a per-field value is stored
+static constexpr Field FIELDS[]{FIELD_POWER,     FIELD_MODE,           FIELD_TARGET_TEMPERATURE, FIELD_MILD_DRY,
+                                FIELD_FAN_SPEED, FIELD_VERTICAL_SWING, FIELD_HORIZONTAL_SWING,   FIELD_PRESET,
+                                FIELD_NANOEX,    FIELD_ECONAVI,        FIELD_ECO};
+static const uint8_t FIELD_COUNT = sizeof(FIELDS) / sizeof(Field);
+
+static const uint8_t POWER_OFF = 0x00;
+static const uint8_t POWER_ON = 0x04;
+
+static const uint8_t MODE_AUTO = 0x00;
+static const uint8_t MODE_DRY = 0x20;
+static const uint8_t MODE_COOL = 0x30;
+static const uint8_t MODE_HEAT = 0x40;
+static const uint8_t MODE_FAN_ONLY = 0x60;
+
+static const uint8_t MILD_DRY_ON = 0x7F;
+static const uint8_t MILD_DRY_OFF = 0x80;
+
+static const uint8_t FAN_SPEED_AUTO = 0xA0;
+static const uint8_t FAN_SPEED_1 = 0x30;
+static const uint8_t FAN_SPEED_2 = 0x40;
+static const uint8_t FAN_SPEED_3 = 0x50;
+static const uint8_t FAN_SPEED_4 = 0x60;
+static const uint8_t FAN_SPEED_5 = 0x70;
+
+static const uint8_t VERTICAL_SWING_UNSUPPORTED = 0x00;
+static const uint8_t VERTICAL_SWING_UP = 0x10;
+static const uint8_t VERTICAL_SWING_UP_CENTER = 0x20;
+static const uint8_t VERTICAL_SWING_CENTER = 0x30;
+static const uint8_t VERTICAL_SWING_DOWN_CENTER = 0x40;
+static const uint8_t VERTICAL_SWING_DOWN = 0x50;
+static const uint8_t VERTICAL_SWING_SWING = 0xE0;
+static const uint8_t VERTICAL_SWING_AUTO = 0xF0;
+
+static const uint8_t HORIZONTAL_SWING_UNSUPPORTED = 0x00;
+static const uint8_t HORIZONTAL_SWING_CENTER = 0x06;
+static const uint8_t HORIZONTAL_SWING_LEFT = 0x09;
+static const uint8_t HORIZONTAL_SWING_LEFT_CENTER = 0x0A;
+static const uint8_t HORIZONTAL_SWING_RIGHT_CENTER = 0x0B;
+static const uint8_t HORIZONTAL_SWING_RIGHT = 0x0C;
+static const uint8_t HORIZONTAL_SWING_AUTO = 0x0D;
+
+static const uint8_t PRESET_NORMAL = 0x00;
+static const uint8_t PRESET_POWERFUL = 0x02;
+static const uint8_t PRESET_QUIET = 0x04;
+
+static const uint8_t ECO_ON = 0x40;
+static const uint8_t ECO_OFF = 0x00;
+
+/*
+ * Typed setters shared by the state block and commands, Derived provides set(Field, uint8_t)
+ */
+template<typename Derived> struct FieldSetters {
+  constexpr void set_power(bool power) { this->derived().set(FIELD_POWER, power ? POWER_ON : POWER_OFF); }
+  constexpr void set_mode(uint8_t mode) { this->derived().set(FIELD_MODE, mode); }
+  constexpr void set_target_temperature(uint8_t temperature) {
+    this->derived().set(FIELD_TARGET_TEMPERATURE, temperature);
+  }
+  constexpr void set_mild_dry(bool mild_dry) {
+    this->derived().set(FIELD_MILD_DRY, mild_dry ? MILD_DRY_ON : MILD_DRY_OFF);
+  }
+  constexpr void set_fan_speed(uint8_t speed) { this->derived().set(FIELD_FAN_SPEED, speed); }
+  constexpr void set_vertical_swing(uint8_t swing) { this->derived().set(FIELD_VERTICAL_SWING, swing); }
+  constexpr void set_horizontal_swing(uint8_t swing) { this->derived().set(FIELD_HORIZONTAL_SWING, swing); }
+  constexpr void set_preset(uint8_t preset) { this->derived().set(FIELD_PRESET, preset); }
+  constexpr void set_nanoex(bool nanoex) { this->derived().set(FIELD_NANOEX, nanoex ? FIELD_NANOEX.mask : 0); }
+  constexpr void set_econavi(bool econavi) {
+    this->derived().set(FIELD_ECONAVI, econavi ? FIELD_ECONAVI.mask : 0);
+  }
+  constexpr void set_eco(bool eco) { this->derived().set(FIELD_ECO, eco ? ECO_ON : ECO_OFF); }
+
+ private:
+  constexpr Derived &derived() { return *static_cast<Derived *>(this); }
+};
+
+/*
+ * The CN-CNT state block as sent in poll responses and control frames
+ */
+struct State : FieldSetters<State> {
+  uint8_t raw[STATE_SIZE];
+
+  constexpr uint8_t get(Field field) const { return this->raw[field.index] & field.mask; }
+  constexpr void set(Field field, uint8_t value) {
+    this->raw[field.index] = (this->raw[field.index] & ~field.mask) | (value & field.mask);
+  }
+
+  constexpr bool power() const { return this->get(FIELD_POWER) != POWER_OFF; }
+  constexpr uint8_t mode() const { return this->get(FIELD_MODE); }
+  constexpr uint8_t target_temperature() const { return this->get(FIELD_TARGET_TEMPERATURE); }
+  constexpr uint8_t mild_dry() const { return this->get(FIELD_MILD_DRY); }
+  constexpr uint8_t fan_speed() const { return this->get(FIELD_FAN_SPEED); }
+  constexpr uint8_t vertical_swing() const { return this->get(FIELD_VERTICAL_SWING); }
+  constexpr uint8_t horizontal_swing() const { return this->get(FIELD_HORIZONTAL_SWING); }
+  constexpr uint8_t preset() const { return this->get(FIELD_PRESET); }
+  constexpr bool nanoex() const { return this->get(FIELD_NANOEX) != 0; }
+  constexpr bool econavi() const { return this->get(FIELD_ECONAVI) != 0; }
+  constexpr uint8_t eco() const { return this->get(FIELD_ECO); }
+
+  // Compares the whole block at once, the fixed size lets the compiler use word compares
+  bool operator==(const State &other) const { return memcmp(this->raw, other.raw, STATE_SIZE) == 0; }
+  bool operator!=(const State &other) const { return !(*this == other); }
+};
+
+/*
+ * Fields changed by the user, only these are applied on top of the latest state when the command is sent
+ */
+struct Command : FieldSetters<Command> {
+  State value{};  // Values of the changed fields
+  State mask{};   // Bits of the changed fields
+
+  State touched{};  // Bits of the fields set since the last take_touched()
+
+  constexpr void set(Field field, uint8_t value) {
+    this->value.set(field, value);
+    this->mask.raw[field.index] |= field.mask;
+    this->touched.raw[field.index] |= field.mask;
+  }
+
+  constexpr bool has(Field field) const { return (this->mask.raw[field.index] & field.mask) != 0; }
+  constexpr void clear(Field field) { this->mask.raw[field.index] &= ~field.mask; }
+
+  // Returns the bits of the fields set since the last call, e.g. to remember when they were changed
+  constexpr State take_touched() {
+    State touched = this->touched;
+    this->touched = State{};
+    return touched;
+  }
+
+  constexpr State apply(const State &state) const {
+    State result{};
+
+    for (uint8_t i = 0; i < STATE_SIZE; i++)
+      result.raw[i] = (state.raw[i] & ~this->mask.raw[i]) | (this->value.raw[i] & this->mask.raw[i]);
+
+    return result;
+  }
+
+  bool empty() const { return this->mask == State{}; }
+  void clear() {
+    this->mask = State{};
+    this->touched = State{};
+  }
+};
+
+/*
+ * Copy the state block out of a frame, data must point to STATE_SIZE bytes
+ */
+constexpr State load_state(const uint8_t *data) {
+  State state{};
+
+  for (uint8_t i = 0; i < STATE_SIZE; i++)
+    state.raw[i] = data[i];
+
+  return state;
+}
+
+constexpr uint16_t determine_power_consumption(uint8_t byte_28, uint8_t byte_29, uint8_t offset) {
+  return (uint16_t) (byte_28 + (byte_29 * 256)) - offset;
+}
+
+static_assert(std::is_trivially_copyable<State>::value, "State must be trivially copyable");
+static_assert(sizeof(State) == STATE_SIZE, "State must not contain padding");
+
+// Fields sharing a byte must not overlap
+static_assert((FIELD_POWER.mask & FIELD_MODE.mask) == 0, "Power and mode overlap");
+static_assert((FIELD_VERTICAL_SWING.mask & FIELD_HORIZONTAL_SWING.mask) == 0, "Swing fields overlap");
+static_assert((FIELD_PRESET.mask & FIELD_NANOEX.mask) == 0 && (FIELD_PRESET.mask & FIELD_ECONAVI.mask) == 0 &&
+                  (FIELD_NANOEX.mask & FIELD_ECONAVI.mask) == 0,
+              "Preset, nanoeX and econavi overlap");
+
+// Values must fit their field
+static_assert((POWER_ON & ~FIELD_POWER.mask) == 0, "Power value out of field");
+static_assert(((MODE_DRY | MODE_COOL | MODE_HEAT | MODE_FAN_ONLY) & ~FIELD_MODE.mask) == 0, "Mode value out of field");
+static_assert(((VERTICAL_SWING_SWING | VERTICAL_SWING_AUTO | VERTICAL_SWING_DOWN) & ~FIELD_VERTICAL_SWING.mask) == 0,
+              "Vertical swing value out of field");
+static_assert(((HORIZONTAL_SWING_AUTO | HORIZONTAL_SWING_LEFT_CENTER | HORIZONTAL_SWING_RIGHT) &
+               ~FIELD_HORIZONTAL_SWING.mask) == 0,
+              "Horizontal swing value out of field");
+static_assert(((PRESET_POWERFUL | PRESET_QUIET) & ~FIELD_PRESET.mask) == 0, "Preset value out of field");
+
+}  // namespace CNT
+}  // namespace panasonic_ac
+}  // namespace esphome
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+namespace esphome {
+namespace panasonic_ac {
+
+/*
+ * A field key the decoder does not know, with the last value it carried
+ */
+struct UnknownField {
+  uint8_t key;
+  uint8_t value;
+  uint32_t count;  // Number of times the key was received
+};
+
+/*
+ * Fixed-size registry of unknown fields received from the AC
+ *
+ * Every key is stored once, so callers can log the first occurrence and summarise the rest instead of logging every
+ * report. Keys that no longer fit are only counted.
+ */
+template<size_t Capacity> class UnknownFieldRegistry {
+  static_assert(Capacity > 0 && Capacity <= 255, "Capacity must fit the 8 bit count");
+
+ public:
+  // Returns true if the key was not seen before
+  bool record(uint8_t key, uint8_t value) {
+    for (uint8_t i = 0; i < this->size_; i++) {
+      if (this->fields_[i].key == key) {
+        this->fields_[i].value = value;
+        this->fields_[i].count++;
+        return false;
+      }
+    }
+
+    if (this->size_ == Capacity) {
+      this->dropped_++;
+      return false;
+    }
+
+    this->fields_[this->size_++] = {key, value, 1};
+    return true;
+  }
+
+  const UnknownField *begin() const { return this->fields_; }
+  const UnknownField *end() const { return this->fields_ + this->size_; }
+
+  bool empty() const { return this->size_ == 0; }
+  uint32_t dropped() const { return this->dropped_; }
+
+  // Formats all fields as "key=value xcount" pairs, e.g. "0x36=0x42 x12 0x37=0x41 x3"
+  std::string to_string() const {
+    std::string text;
+    char field[24];
+
+    for (const UnknownField &entry : *this) {
+      snprintf(field, sizeof(field), "%s0x%02X=0x%02X x%u", text.empty() ? "" : " ", entry.key, entry.value,
+               (unsigned) entry.count);
+      text += field;
+    }
+
+    return text;
+  }
+
+ protected:
+  UnknownField fields_[Capacity];
+  uint8_t size_ = 0;      // Number of keys stored
+  uint32_t dropped_ = 0;  // Number of fields received with a key that did not fit anymore
+};
+
+}  // namespace panasonic_ac
+}  // namespace esphome
@@ -1,8 +1,11 @@
 #include "esppac_wlan.h"
 #include "esppac_commands_wlan.h"
+#include "esppac_registers_wlan.h"
 
 #include "esphome/core/log.h"
 
+#include <cinttypes>
+
 namespace esphome {
 namespace panasonic_ac {
 namespace WLAN {
@@ -12,22 +15,53 @@ static const char *const TAG = "panasonic_ac.dnskp11";
 void PanasonicACWLAN::setup() {
   PanasonicAC::setup();
 
+  if (this->is_passive()) {
+    this->state_ = ACState::Ready;  // The official adapter does the handshake, we never send
+    ESP_LOGD(TAG, "Listening to DNSK-P11 protocol via CN-WLAN");
+    return;
+  }
+
+  this->arm_timer(Timer::InitFail, this->init_time_, INIT_FAIL_TIMEOUT);
+  this->arm_init_timer();
+
   ESP_LOGD(TAG, "Using DNSK-P11 protocol via CN-WLAN");
 }
 
+void PanasonicACWLAN::dump_config() {
+  PanasonicAC::dump_config();
+
+  float rate = this->reports_received_ > 0 ? 100.0f * this->reports_duplicate_ / this->reports_received_ : 0.0f;
+  ESP_LOGCONFIG(TAG, "  Reports received: %" PRIu32 ", resent: %" PRIu32 " (%.1f%%)", this->reports_received_,
+                this->reports_duplicate_, rate);
+
+  for (const UnknownField &field : this->unknown_fields_)
+    ESP_LOGCONFIG(TAG, "  Unknown field 0x%02X: last value 0x%02X, received %" PRIu32 " times", field.key, field.value,
+                  field.count);
+  if (this->unknown_fields_.dropped() > 0)
+    ESP_LOGCONFIG(TAG, "  Unknown fields not tracked: %" PRIu32, this->unknown_fields_.dropped());
+}
+
+#ifdef USE_PANASONIC_AC_UNKNOWN_FIELDS_SENSOR
+void PanasonicACWLAN::set_unknown_fields_sensor(text_sensor::TextSensor *unknown_fields_sensor) {
+  this->unknown_fields_sensor_ = unknown_fields_sensor;
+}
+#endif
+
 void PanasonicACWLAN::loop() {
+  if (this->is_idle())
+    return;  // Nothing received and no deadline reached yet
+
   if (this->state_ != ACState::Ready) {
     handle_init_packets();  // Handle initialization packets separate from normal packets
 
-    if (millis() - this->init_time_ > INIT_FAIL_TIMEOUT) {
+    if (this->is_timer_due(Timer::InitFail)) {
       this->state_ = ACState::Failed;
       mark_failed();
       return;
     }
   }
 
-  if (millis() - this->last_read_ > READ_TIMEOUT &&
-      !this->rx_buffer_.empty())  // Check if our read timed out and we received something
+  if (this->receive_packet())  // Check if we received a complete packet
   {
     log_packet(this->rx_buffer_);
 
@@ -44,12 +78,16 @@ void PanasonicACWLAN::loop() {
 
     this->waiting_for_response_ =
         false;  // Set that we are not waiting for a response anymore since we received a valid one
-    this->last_packet_received_ = millis();  // Set the time at which we received our last packet
+    this->cancel_timer(Timer::Resend);
+    this->last_packet_received_ = this->now_ms();  // Set the time at which we received our last packet
 
     if (this->state_ == ACState::Ready || this->state_ == ACState::FirstPoll ||
         this->state_ == ACState::HandshakeEnding)  // Parse regular packets
     {
-      handle_packet();  // Handle regular packet
+      acknowledge_packet();  // Answer before decoding so the AC does not resend
+
+      if (!is_duplicate_report())  // Resent reports were already handled, only the ack was lost
+        handle_packet();           // Handle regular packet
     } else              // Parse handshake packets
     {
       handle_handshake_packet();  // Not initialized yet, handle handshake packet
@@ -58,11 +96,17 @@ void PanasonicACWLAN::loop() {
     this->rx_buffer_.clear();  // Reset buffer
   }
 
-  PanasonicAC::read_data();
+#ifdef USE_PANASONIC_AC_PASSIVE
+  if (this->receive_controller_packet()) {
+    log_packet(this->controller_buffer_, true);  // Recorded as outgoing, it travels the way our commands would
+    handle_controller_packet();
+    this->controller_buffer_.clear();
+  }
+#endif
 
-  handle_resend();  // Handle packets that need to be resent
+  handle_transmit();  // Send responses, resends, commands and polls in that order
 
-  handle_poll();  // Handle sending poll packets
+  handle_current_temperature_sensor();  // Publish rate limited external temperature updates
 }
 
 /*
@@ -70,74 +114,39 @@ void PanasonicACWLAN::loop() {
  */
 
 void PanasonicACWLAN::control(const climate::ClimateCall &call) {
-  if (this->state_ != ACState::Ready)
+  if (this->is_passive()) {
+    ESP_LOGW(TAG, "Ignoring control request in passive mode");
+    this->publish_state();  // Revert the frontend to the observed state
     return;
+  }
 
   if (call.get_mode().has_value()) {
     ESP_LOGV(TAG, "Requested mode change");
 
-    switch (*call.get_mode()) {
-      case climate::CLIMATE_MODE_COOL:
-        set_value(0xB0, 0x42);
-        set_value(0x80, 0x30);
-        break;
-      case climate::CLIMATE_MODE_HEAT:
-        set_value(0xB0, 0x43);
-        set_value(0x80, 0x30);
-        break;
-      case climate::CLIMATE_MODE_DRY:
-        set_value(0xB0, 0x44);
-        set_value(0x80, 0x30);
-        break;
-      case climate::CLIMATE_MODE_HEAT_COOL:
-        set_value(0xB0, 0x41);
-        set_value(0x80, 0x30);
-        break;
-      case climate::CLIMATE_MODE_FAN_ONLY:
-        set_value(0xB0, 0x45);
-        set_value(0x80, 0x30);
-        break;
-      case climate::CLIMATE_MODE_OFF:
-        set_value(0x80, 0x31);
-        break;
-      default:
-        ESP_LOGV(TAG, "Unsupported mode requested");
-        break;
-    }
+    const ModeValue *mode = find_mode(MODES, *call.get_mode());
 
-    this->mode =
-        *call.get_mode();   // Set mode manually since we won't receive a report from the AC if its the same mode again
-    this->publish_state();  // Send this state, will get updated once next poll is executed
+    if (*call.get_mode() == climate::CLIMATE_MODE_OFF) {
+      set_value(KEY_POWER, POWER_OFF);
+    } else if (mode != nullptr) {
+      set_value(KEY_MODE, mode->value);
+      set_value(KEY_POWER, POWER_ON);
+    } else
+      ESP_LOGV(TAG, "Unsupported mode requested");
   }
 
   if (call.get_target_temperature().has_value()) {
     ESP_LOGV(TAG, "Requested target temp change to %.2f, %.2f including offset", *call.get_target_temperature(), *call.get_target_temperature() - this->current_temperature_offset_);
-    set_value(0x31, (*call.get_target_temperature() - this->current_temperature_offset_) * 2);
+    set_value(KEY_TARGET_TEMPERATURE, this->encode_target_temperature(*call.get_target_temperature()));
   }
 
   if (call.has_custom_fan_mode()) {
     ESP_LOGV(TAG, "Requested fan mode change");
 
-    const StringRef fanMode = call.get_custom_fan_mode();
-
-    if (fanMode == "Automatic") {
-      set_value(0xB2, 0x41);
-      set_value(0xA0, 0x41);
-    } else if (fanMode == "1") {
-      set_value(0xB2, 0x41);
-      set_value(0xA0, 0x32);
-    } else if (fanMode == "2") {
-      set_value(0xB2, 0x41);
-      set_value(0xA0, 0x33);
-    } else if (fanMode == "3") {
-      set_value(0xB2, 0x41);
-      set_value(0xA0, 0x34);
-    } else if (fanMode == "4") {
-      set_value(0xB2, 0x41);
-      set_value(0xA0, 0x35);
-    } else if (fanMode == "5") {
-      set_value(0xB2, 0x41);
-      set_value(0xA0, 0x36);
+    const NamedValue *fanSpeed = find_name(FAN_SPEEDS, call.get_custom_fan_mode());
+
+    if (fanSpeed != nullptr) {
+      set_value(KEY_PRESET, PRESET_NORMAL);
+      set_value(KEY_FAN_SPEED, fanSpeed->value);
     } else
       ESP_LOGV(TAG, "Unsupported fan mode requested");
   }
@@ -145,122 +154,232 @@ void PanasonicACWLAN::control(const climate::ClimateCall &call) {
   if (call.get_swing_mode().has_value()) {
     ESP_LOGV(TAG, "Requested swing mode change");
 
-    switch (*call.get_swing_mode()) {
-      case climate::CLIMATE_SWING_BOTH:
-        set_value(0xA1, 0x41);
-        break;
-      case climate::CLIMATE_SWING_OFF:
-        set_value(0xA1, 0x42);
-        set_value(0xA4, 0x43);
-        set_value(0xA5, 0x43);
-        set_value(0x35, 0x42);
-        break;
-      case climate::CLIMATE_SWING_VERTICAL:
-        set_value(0xA1, 0x43);
-        set_value(0xA5, 0x43);
-        break;
-      case climate::CLIMATE_SWING_HORIZONTAL:
-        set_value(0xA1, 0x44);
-        set_value(0xA4, 0x43);
-        break;
-      default:
-        ESP_LOGV(TAG, "Unsupported swing mode requested");
-        break;
-    }
+    climate::ClimateSwingMode swingMode = *call.get_swing_mode();
+    const SwingValue *swing = find_swing(SWING_MODES, swingMode);
+
+    if (swing != nullptr) {
+      set_value(KEY_SWING_MODE, swing->value);
+
+      // Center the axes that stop swinging, shown right away so a select change before the report is compared
+      // against the new position
+      if (swingMode == climate::CLIMATE_SWING_OFF || swingMode == climate::CLIMATE_SWING_HORIZONTAL) {
+        set_value(KEY_VERTICAL_SWING, SWING_CENTER);
+        update_swing_vertical(StringRef(find_value(VERTICAL_SWINGS, SWING_CENTER)->name));
+      }
+      if (swingMode == climate::CLIMATE_SWING_OFF || swingMode == climate::CLIMATE_SWING_VERTICAL) {
+        set_value(KEY_HORIZONTAL_SWING, SWING_CENTER);
+        update_swing_horizontal(StringRef(find_value(HORIZONTAL_SWINGS, SWING_CENTER)->name));
+      }
+      if (swingMode == climate::CLIMATE_SWING_OFF)
+        set_value(KEY_UNKNOWN_35, VALUE_OFF);
+    } else
+      ESP_LOGV(TAG, "Unsupported swing mode requested");
   }
 
   if (call.has_custom_preset()) {
     ESP_LOGV(TAG, "Requested preset change");
 
-    const StringRef preset = call.get_custom_preset();
-
-    if (preset == "Normal") {
-      set_value(0xB2, 0x41);
-      set_value(0x35, 0x42);
-      set_value(0x34, 0x42);
-    } else if (preset == "Powerful") {
-      set_value(0xB2, 0x42);
-      set_value(0x35, 0x42);
-      set_value(0x34, 0x42);
-    } else if (preset == "Quiet") {
-      set_value(0xB2, 0x43);
-      set_value(0x35, 0x42);
-      set_value(0x34, 0x42);
+    const NamedValue *preset = find_name(PRESETS, call.get_custom_preset());
+
+    if (preset != nullptr) {
+      set_value(KEY_PRESET, preset->value);
+      set_value(KEY_UNKNOWN_35, VALUE_OFF);
+      set_value(KEY_UNKNOWN_34, VALUE_OFF);
     } else
       ESP_LOGV(TAG, "Unsupported preset requested");
   }
 
   if (this->set_queue_index_ > 0)  // Only send packet if any changes need to be made
   {
-    send_set_command();
+    this->schedule_command();
   }
+
+  // Set state manually since we won't receive a report from the AC if its the same state again,
+  // will get updated once next poll is executed
+  this->publish_optimistic_state(call);
 }
 
 /*
  * Loop handling
  */
 
-void PanasonicACWLAN::handle_poll() {
-  if (this->state_ == ACState::Ready && millis() - this->last_packet_sent_ > POLL_INTERVAL) {
-    ESP_LOGV(TAG, "Polling AC");
-    send_command(CMD_POLL, sizeof(CMD_POLL));
+/*
+ * Send at most one packet, time critical responses first, then resends, user commands and polls
+ */
+void PanasonicACWLAN::handle_transmit() {
+  if (this->is_passive() || !this->can_transmit())
+    return;  // Never transmit in passive mode
+
+  if (send_response())
+    return;
+
+  if (handle_resend())
+    return;
+
+  if (handle_cmd())
+    return;
+
+  handle_poll();
+}
+
+/*
+ * Returns true if the last packet was sent completely and enough time passed, delays due requests otherwise
+ */
+bool PanasonicACWLAN::can_transmit() {
+  if (this->now_ms() - this->last_packet_sent_ >= this->transmit_spacing_)
+    return true;
+
+  for (Timer timer : {Timer::Resend, Timer::Command, Timer::Poll}) {
+    if (this->is_timer_due(timer))
+      this->arm_timer(timer, this->last_packet_sent_, this->transmit_spacing_);
+  }
+
+  return false;
+}
+
+void PanasonicACWLAN::queue_response(const uint8_t *command, size_t length, CommandType type) {
+  if (this->response_count_ >= RESPONSE_QUEUE_SIZE) {
+    ESP_LOGW(TAG, "Response queue overflow");
+    return;
+  }
+
+  this->response_queue_[this->response_count_].command = command;
+  this->response_queue_[this->response_count_].length = length;
+  this->response_queue_[this->response_count_].type = type;
+  this->response_count_++;
+
+  this->arm_timer(Timer::Transmit, this->last_packet_sent_, this->transmit_spacing_);
+}
+
+bool PanasonicACWLAN::send_response() {
+  if (this->response_count_ == 0)
+    return false;
+
+  PendingResponse response = this->response_queue_[0];
+
+  this->response_count_--;
+  for (uint8_t i = 0; i < this->response_count_; i++)
+    this->response_queue_[i] = this->response_queue_[i + 1];
+
+  send_command(response.command, response.length, response.type);
+
+  if (this->response_count_ > 0)
+    this->arm_timer(Timer::Transmit, this->last_packet_sent_, this->transmit_spacing_);
+  else
+    this->cancel_timer(Timer::Transmit);
+
+  return true;
+}
+
+bool PanasonicACWLAN::handle_poll() {
+  if (!this->is_timer_due(Timer::Poll))
+    return false;
+
+  if (this->state_ != ACState::Ready) {
+    this->cancel_timer(Timer::Poll);  // Polling starts after the handshake, the next sent packet arms it again
+    return false;
   }
+
+  ESP_LOGV(TAG, "Polling AC");
+  send_command(CMD_POLL, sizeof(CMD_POLL));
+
+  return true;
+}
+
+bool PanasonicACWLAN::handle_cmd() {
+  if (!this->is_command_due(this->state_ == ACState::Ready, 0))
+    return false;
+
+  if (this->set_queue_index_ == 0)
+    return false;
+
+  send_set_command();
+  this->commands_sent_++;
+
+  return true;
 }
 
 void PanasonicACWLAN::handle_init_packets() {
-  if (this->state_ == ACState::Initializing) {
-    if (millis() - this->init_time_ > INIT_TIMEOUT)  // Handle handshake initialization
-    {
-      ESP_LOGD(TAG, "Starting handshake [1/16]");
-      send_command(CMD_HANDSHAKE_1,
-                   sizeof(CMD_HANDSHAKE_1));  // Send first handshake packet, AC won't send a response
-      delay(3);                               // Add small delay to mimic real wifi adapter
-      send_command(CMD_HANDSHAKE_2,
-                   sizeof(CMD_HANDSHAKE_2));  // Send second handshake packet, AC won't send a response
-                                              // but we will trigger a resend
-
-      this->state_ = ACState::Handshake;  // Update state to handshake started
-    }
-  } else if (this->state_ == ACState::FirstPoll &&
-             millis() - this->last_packet_sent_ > FIRST_POLL_TIMEOUT)  // Handle sending first poll
+  if (!this->is_timer_due(Timer::Init) || this->response_count_ > 0)
+    return;  // Queued steps are sent first, the timer is armed relative to them
+
+  if (this->state_ == ACState::Initializing)  // Handle handshake initialization
+  {
+    ESP_LOGD(TAG, "Starting handshake [1/16]");
+    queue_response(CMD_HANDSHAKE_1, sizeof(CMD_HANDSHAKE_1),
+                   CommandType::Normal);  // Send first handshake packet, AC won't send a response
+    queue_response(CMD_HANDSHAKE_2, sizeof(CMD_HANDSHAKE_2),
+                   CommandType::Normal);  // Send second handshake packet, AC won't send a response
+                                          // but we will trigger a resend
+
+    this->state_ = ACState::Handshake;  // Update state to handshake started
+  } else if (this->state_ == ACState::FirstPoll)  // Handle sending first poll
   {
     ESP_LOGD(TAG, "Polling for the first time");
-    send_command(CMD_POLL, sizeof(CMD_POLL));
 
     this->state_ = ACState::HandshakeEnding;
-  } else if (this->state_ == ACState::HandshakeEnding &&
-             millis() - this->last_packet_sent_ > INIT_END_TIMEOUT)  // Handle last handshake message
+    queue_response(CMD_POLL, sizeof(CMD_POLL), CommandType::Normal);
+  } else if (this->state_ == ACState::HandshakeEnding)  // Handle last handshake message
   {
     ESP_LOGD(TAG, "Finishing handshake [16/16]");
-    send_command(CMD_HANDSHAKE_16, sizeof(CMD_HANDSHAKE_16));
+    queue_response(CMD_HANDSHAKE_16, sizeof(CMD_HANDSHAKE_16), CommandType::Normal);
 
     // State is set to ready in the response to this packet
   }
+
+  this->arm_init_timer();
 }
 
-bool PanasonicACWLAN::verify_packet() {
-  if (this->rx_buffer_.size() < 5)  // Drop packets that are too short
-  {
-    ESP_LOGW(TAG, "Dropping invalid packet (length)");
-    this->rx_buffer_.clear();  // Reset buffer
-    return false;
+/*
+ * Arm the timer for the next initialization step depending on the current state
+ */
+void PanasonicACWLAN::arm_init_timer() {
+  switch (this->state_) {
+    case ACState::Initializing:
+      this->arm_timer(Timer::Init, this->init_time_, INIT_TIMEOUT);
+      break;
+    case ACState::FirstPoll:
+      this->arm_timer(Timer::Init, this->last_packet_sent_, FIRST_POLL_TIMEOUT);
+      break;
+    case ACState::HandshakeEnding:
+      this->arm_timer(Timer::Init, this->last_packet_sent_, INIT_END_TIMEOUT);
+      break;
+    default:
+      this->cancel_timer(Timer::Init);  // Waiting for the AC or done
+      break;
   }
+}
 
-  if (this->rx_buffer_[0] == 0x66)  // Sync packets are the only packet not starting with 0x5A
+bool PanasonicACWLAN::verify_packet() {
+  if (this->rx_buffer_.size() >= MIN_FRAME_SIZE && this->rx_buffer_[0] == SYNC_HEADER)
   {
+    if (this->is_passive()) {
+      this->rx_buffer_.clear();  // The official adapter answers the sync
+      return false;
+    }
+
     ESP_LOGI(TAG, "Received sync packet, triggering initialization");
     this->init_time_ -= INIT_TIMEOUT;  // Set init time back to trigger a initialization now
+    this->arm_init_timer();
     this->rx_buffer_.clear();          // Reset buffer
     return false;
   }
 
-  if (this->rx_buffer_[0] != HEADER)  // Check if header matches
-  {
-    ESP_LOGW(TAG, "Dropping invalid packet (header)");
+  FrameError error = check_frame(FrameView(this->rx_buffer_));  // Check length, header and checksum
+
+  if (error != FrameError::None) {
+    if (error == FrameError::Length || error == FrameError::Header)
+      ESP_LOGW(TAG, "Dropping invalid packet (%s)", frame_error_to_string(error));
+    else
+      ESP_LOGD(TAG, "Dropping invalid packet (%s)", frame_error_to_string(error));
+
     this->rx_buffer_.clear();  // Reset buffer
     return false;
   }
 
+  if (this->is_passive())
+    return true;  // Packet counters belong to the session of the official adapter
+
   if (this->state_ == ACState::Ready && this->waiting_for_response_)  // If we were waiting for a response, check if the
                                                                       // tx packet counter matches (if we are ready)
   {
@@ -275,25 +394,83 @@ bool PanasonicACWLAN::verify_packet() {
   {
     if (this->rx_buffer_[1] != this->receive_packet_count_)  // Check receive packet counter
     {
-      ESP_LOGW(TAG, "Correcting shifted rx counter");
+      if (!is_recent_counter(this->rx_buffer_[1]))  // Resent packets reuse their counter, that is not a shift
+        ESP_LOGW(TAG, "Correcting shifted rx counter");
+
       this->receive_packet_count_ = this->rx_buffer_[1];
     }
   }
 
-  uint8_t checksum = 0;  // Set checksum to first byte
+  return true;
+}
 
-  for (uint8_t i : this->rx_buffer_)  // Add all bytes together
-    checksum += i;
+/*
+ * Answer packets that need a response right after they were verified, before decoding them
+ */
+void PanasonicACWLAN::acknowledge_packet() {
+  if (this->is_passive())
+    return;  // The official adapter answers
 
-  if (checksum != 0)  // Check if checksum is valid
+  if (this->rx_buffer_[2] == 0x01 && this->rx_buffer_[3] == 0x01)  // Ping
   {
-    ESP_LOGD(TAG, "Dropping invalid packet (checksum)");
+    ESP_LOGD(TAG, "Answering ping");
+    queue_response(CMD_PING, sizeof(CMD_PING));
+  } else if (this->rx_buffer_[2] == 0x10 && this->rx_buffer_[3] == 0x0A)  // Report
+  {
+    ESP_LOGV(TAG, "Acknowledging report");
+    queue_response(CMD_REPORT_ACK, sizeof(CMD_REPORT_ACK));
+  } else {
+    return;  // Nothing to answer
+  }
 
-    this->rx_buffer_.clear();  // Reset buffer
-    return false;
+  if (can_transmit())
+    send_response();
+}
+
+/*
+ * Duplicate detection
+ */
+
+bool PanasonicACWLAN::is_recent_counter(uint8_t counter) {
+  for (uint8_t i = 0; i < this->seen_report_count_; i++) {
+    if (this->seen_reports_[i].counter == counter)
+      return true;
   }
 
-  return true;
+  return false;
+}
+
+/*
+ * Returns true if the received packet is a report that was already seen, remembers it otherwise
+ */
+bool PanasonicACWLAN::is_duplicate_report() {
+  if (this->rx_buffer_[2] != 0x10 || this->rx_buffer_[3] != 0x0A)
+    return false;  // Only reports are resent by the AC
+
+  uint32_t hash = 2166136261UL;  // FNV-1a over the payload, without header, counter and checksum
+  for (size_t i = 2; i < this->rx_buffer_.size() - 1; i++) {
+    hash ^= this->rx_buffer_[i];
+    hash *= 16777619UL;
+  }
+
+  this->reports_received_++;
+
+  for (uint8_t i = 0; i < this->seen_report_count_; i++) {
+    if (this->seen_reports_[i].counter == this->rx_buffer_[1] && this->seen_reports_[i].hash == hash) {
+      ESP_LOGD(TAG, "Ignoring resent report 0x%02X", this->rx_buffer_[1]);
+      this->reports_duplicate_++;
+      return true;
+    }
+  }
+
+  this->seen_reports_[this->seen_report_index_].counter = this->rx_buffer_[1];
+  this->seen_reports_[this->seen_report_index_].hash = hash;
+  this->seen_report_index_ = (this->seen_report_index_ + 1) % REPORT_WINDOW_SIZE;
+
+  if (this->seen_report_count_ < REPORT_WINDOW_SIZE)
+    this->seen_report_count_++;
+
+  return false;
 }
 
 /*
@@ -301,161 +478,256 @@ bool PanasonicACWLAN::verify_packet() {
  */
 
 static climate::ClimateMode determine_mode(uint8_t mode) {
-  switch (mode)  // Check mode
-  {
-    case 0x41:  // Auto
-      return climate::CLIMATE_MODE_HEAT_COOL;
-    case 0x42:  // Cool
-      return climate::CLIMATE_MODE_COOL;
-    case 0x43:  // Heat
-      return climate::CLIMATE_MODE_HEAT;
-    case 0x44:  // Dry
-      return climate::CLIMATE_MODE_DRY;
-    case 0x45:  // Fan only?
-      return climate::CLIMATE_MODE_FAN_ONLY;
-    default:
-      ESP_LOGW(TAG, "Received unknown climate mode");
-      return climate::CLIMATE_MODE_OFF;
+  const ModeValue *entry = find_value(MODES, mode);
+
+  if (entry == nullptr) {
+    ESP_LOGW(TAG, "Received unknown climate mode");
+    return climate::CLIMATE_MODE_OFF;
   }
+
+  return entry->mode;
 }
 
-static const char *determine_fan_speed(uint8_t speed) {
-  switch (speed) {
-    case 0x32:  // 1
-      return "1";
-    case 0x33:  // 2
-      return "2";
-    case 0x34:  // 3
-      return "3";
-    case 0x35:  // 4
-      return "4";
-    case 0x36:  // 5
-      return "5";
-    case 0x41:  // Auto
-      return "Automatic";
-    default:
-      ESP_LOGW(TAG, "Received unknown fan speed");
-      return "Unknown";
+static climate::ClimateSwingMode determine_swing(uint8_t swing) {
+  const SwingValue *entry = find_value(SWING_MODES, swing);
+
+  if (entry == nullptr) {
+    ESP_LOGW(TAG, "Received unknown swing mode");
+    return climate::CLIMATE_SWING_OFF;
   }
+
+  return entry->swing;
 }
 
-static const char *determine_preset(uint8_t preset) {
-  switch (preset) {
-    case 0x43:  // Quiet
-      return "Quiet";
-    case 0x42:  // Powerful
-      return "Powerful";
-    case 0x41:  // Normal
-      return "Normal";
-    default:
-      ESP_LOGW(TAG, "Received unknown preset");
-      return "Normal";
+// Returns the option name of value in table, or fallback if the value is unknown
+template<size_t N>
+static const char *determine_option(const NamedValue (&table)[N], uint8_t value, const char *field,
+                                    const char *fallback) {
+  const NamedValue *entry = find_value(table, value);
+
+  if (entry == nullptr) {
+    ESP_LOGW(TAG, "Received unknown %s", field);
+    return fallback;
   }
+
+  return entry->name;
 }
 
+static const char *determine_fan_speed(uint8_t speed) {
+  return determine_option(FAN_SPEEDS, speed, "fan speed", "Unknown");
+}
+
+static const char *determine_preset(uint8_t preset) { return determine_option(PRESETS, preset, "preset", "Normal"); }
+
 static const char *determine_swing_vertical(uint8_t swing) {
-  switch (swing) {
-    case 0x42:  // Down
-      return "down";
-    case 0x45:  // Down center
-      return "down_center";
-    case 0x43:  // Center
-      return "center";
-    case 0x44:  // Up Center
-      return "up_center";
-    case 0x41:  // Up
-      return "up";
-    default:
-      ESP_LOGW(TAG, "Received unknown vertical swing position");
-      return "Unknown";
-  }
+  return determine_option(VERTICAL_SWINGS, swing, "vertical swing position", "Unknown");
 }
 
 static const char *determine_swing_horizontal(uint8_t swing) {
-  switch (swing) {
-    case 0x42:  // Left
-      return "left";
-    case 0x5C:  // Left center
-      return "left_center";
-    case 0x43:  // Center
-      return "center";
-    case 0x56:  // Right center
-      return "right_center";
-    case 0x41:  // Right
-      return "right";
-    default:
-      ESP_LOGW(TAG, "Received unknown horizontal swing position");
-      return "Unknown";
+  return determine_option(HORIZONTAL_SWINGS, swing, "horizontal swing position", "Unknown");
+}
+
+static constexpr bool determine_nanoex(uint8_t nanoex) { return nanoex != VALUE_OFF; }
+
+/*
+ * Unknown fields are logged once per key, repeats are only counted and summarised every few minutes
+ */
+void PanasonicACWLAN::record_unknown_field(uint8_t key, uint8_t value) {
+  if (this->unknown_fields_.record(key, value)) {
+    ESP_LOGW(TAG, "Report has unknown field 0x%02X with value 0x%02X", key, value);
+    this->publish_unknown_fields();
+    return;
+  }
+
+  ESP_LOGV(TAG, "Report has unknown field 0x%02X with value 0x%02X", key, value);
+
+  if (this->now_ms() - this->last_unknown_field_summary_ >= UNKNOWN_FIELD_SUMMARY_INTERVAL) {
+    for (const UnknownField &field : this->unknown_fields_)
+      ESP_LOGI(TAG, "Unknown field 0x%02X: last value 0x%02X, received %" PRIu32 " times", field.key, field.value,
+               field.count);
+
+    this->publish_unknown_fields();
   }
 }
 
-static climate::ClimateSwingMode determine_swing(uint8_t swing) {
-  switch (swing) {
-    case 0x41:  // Both
-      return climate::CLIMATE_SWING_BOTH;
-    case 0x42:  // Off
-      return climate::CLIMATE_SWING_OFF;
-    case 0x43:  // Vertical
-      return climate::CLIMATE_SWING_VERTICAL;
-    case 0x44:  // Horizontal
-      return climate::CLIMATE_SWING_HORIZONTAL;
-    default:
-      ESP_LOGW(TAG, "Received unknown swing mode");
-      return climate::CLIMATE_SWING_OFF;
+// Restarts the summary interval and publishes the registry to the text sensor if configured
+void PanasonicACWLAN::publish_unknown_fields() {
+  this->last_unknown_field_summary_ = this->now_ms();
+
+#ifdef USE_PANASONIC_AC_UNKNOWN_FIELDS_SENSOR
+  if (this->unknown_fields_sensor_ != nullptr)
+    this->unknown_fields_sensor_->publish_state(this->unknown_fields_.to_string());
+#endif
+}
+
+/*
+ * Decode the key/value pairs of reports and set commands, both use the same layout
+ */
+void PanasonicACWLAN::decode_fields(FrameView frame, FieldSource source) {
+  // 0 = Header & packet type
+  // 1 = Packet length
+  // 2 = Key value pair counter
+  for (int i = 0; i < frame[10]; i++) {
+    // Offset everything by header, packet length and pair counter (4 * 3)
+    // then offset by pair length (i * 4)
+    int currentIndex = (4 * 3) + (i * 4);
+
+    if (!frame.has(currentIndex, 3)) {
+      ESP_LOGW(TAG, "Packet is shorter than its field count");
+      break;
+    }
+
+    // 0 = Header
+    // 1 = Data
+    // 2 = Data
+    // 3 = ?
+    switch (frame[currentIndex]) {
+      case KEY_POWER:
+        switch (frame[currentIndex + 2]) {
+          case POWER_ON:
+            ESP_LOGV(TAG, "Received power mode on");
+            // Ignore power on and let mode be set by other report
+            break;
+          case POWER_OFF:
+            ESP_LOGV(TAG, "Received power mode off");
+            this->mode = climate::CLIMATE_MODE_OFF;
+            break;
+          default:
+            ESP_LOGW(TAG, "Received unknown power mode");
+            break;
+        }
+        break;
+      case KEY_MODE:
+        this->mode = determine_mode(frame[currentIndex + 2]);
+        break;
+      case KEY_TARGET_TEMPERATURE:
+        ESP_LOGV(TAG, "Received target temperature");
+        update_target_temperature((int8_t) frame[currentIndex + 2]);
+        break;
+      case KEY_FAN_SPEED:
+        ESP_LOGV(TAG, "Received fan speed");
+        this->set_custom_fan_mode_(determine_fan_speed(frame[currentIndex + 2]));
+        break;
+      case KEY_PRESET:
+        ESP_LOGV(TAG, "Received preset");
+        this->set_custom_preset_(determine_preset(frame[currentIndex + 2]));
+        break;
+      case KEY_SWING_MODE:
+        ESP_LOGV(TAG, "Received swing mode");
+        this->swing_mode = determine_swing(frame[currentIndex + 2]);
+        break;
+      case KEY_HORIZONTAL_SWING:
+        ESP_LOGV(TAG, "Received horizontal swing position");
+
+        update_swing_horizontal(StringRef(determine_swing_horizontal(frame[currentIndex + 2])));
+        break;
+      case KEY_VERTICAL_SWING:
+        ESP_LOGV(TAG, "Received vertical swing position");
+
+        update_swing_vertical(StringRef(determine_swing_vertical(frame[currentIndex + 2])));
+        break;
+      case KEY_NANOEX:
+        ESP_LOGV(TAG, "Received nanoex state");
+
+        update_nanoex(determine_nanoex(frame[currentIndex + 2]));
+        break;
+      case KEY_NANOEX_UNKNOWN:
+        ESP_LOGV(TAG, "Received unknown nanoex field");
+        // Not sure what this one, ignore it for now
+        break;
+      default:
+        if (source == FieldSource::Report)
+          record_unknown_field(frame[currentIndex], frame[currentIndex + 2]);
+        else
+          ESP_LOGV(TAG, "Set command has unknown field 0x%02X with value 0x%02X", frame[currentIndex],
+                   frame[currentIndex + 2]);
+        break;
+    }
   }
 }
 
-static constexpr bool determine_nanoex(uint8_t nanoex) {
-  switch (nanoex) {
-    case 0x42:
-      return false;
-    default:
+/*
+ * Packet handling
+ */
+
+#ifdef USE_PANASONIC_AC_PASSIVE
+// Packet types the AC sends while the official adapter sets up its session, see handle_handshake_packet()
+static const uint8_t HANDSHAKE_PACKETS[][2]{{0x00, 0x89}, {0x00, 0x8C}, {0x00, 0x90}, {0x00, 0x91}, {0x00, 0x92},
+                                            {0x00, 0xC1}, {0x01, 0xCC}, {0x10, 0x80}, {0x10, 0x81}, {0x00, 0x98},
+                                            {0x01, 0x80}, {0x01, 0x09}, {0x00, 0x20}};
+
+static bool is_handshake_packet(uint8_t high, uint8_t low) {
+  for (const uint8_t(&type)[2] : HANDSHAKE_PACKETS) {
+    if (type[0] == high && type[1] == low)
       return true;
   }
+
+  return false;
 }
 
 /*
- * Packet handling
+ * Decode set commands sent by the official adapter, the AC confirms them with a report
  */
+void PanasonicACWLAN::handle_controller_packet() {
+  FrameView frame(this->controller_buffer_);
+  FrameError error = check_frame(frame);
+
+  if (error != FrameError::None) {
+    ESP_LOGD(TAG, "Dropping invalid controller packet (%s)", frame_error_to_string(error));
+    return;
+  }
+
+  if (frame[2] != 0x10 || frame[3] != 0x08 || frame.size() < 13)
+    return;  // Only set commands change the state, everything else is answered by the AC
+
+  ESP_LOGD(TAG, "Controller sent set command");
+
+  decode_fields(frame, FieldSource::SetCommand);
+
+  this->action = determine_action();
+  this->publish_state();
+}
+#endif
 
 void PanasonicACWLAN::handle_packet() {
   if (this->rx_buffer_[2] == 0x01 && this->rx_buffer_[3] == 0x01)  // Ping
   {
-    ESP_LOGD(TAG, "Answering ping");
-    send_command(CMD_PING, sizeof(CMD_PING), CommandType::Response);
+    ESP_LOGV(TAG, "Received ping");  // Already answered in acknowledge_packet()
   } else if (this->rx_buffer_[2] == 0x10 && this->rx_buffer_[3] == 0x89)  // Received query response
   {
     ESP_LOGD(TAG, "Received query response");
 
-    if (this->rx_buffer_.size() != 125) {
+    FrameView frame(this->rx_buffer_);
+
+    if (frame.size() != 125) {
       ESP_LOGW(TAG, "Received invalid query response");
       return;
     }
 
-    if (this->rx_buffer_[14] == 0x31)          // Check if power state is off
+    if (frame[14] == POWER_OFF)                // Check if power state is off
       this->mode = climate::CLIMATE_MODE_OFF;  // Climate is off
     else {
-      this->mode = determine_mode(this->rx_buffer_[18]);  // Check mode if power state is not off
+      this->mode = determine_mode(frame[18]);  // Check mode if power state is not off
     }
 
-    update_target_temperature((int8_t) this->rx_buffer_[22]);
-    update_current_temperature((int8_t) this->rx_buffer_[62]);
-    update_outside_temperature((int8_t) this->rx_buffer_[66]);  // Set current (outside) temperature
+    update_target_temperature((int8_t) frame[22]);
+    update_current_temperature((int8_t) frame[62]);
+    update_outside_temperature((int8_t) frame[66]);  // Set current (outside) temperature
 
-    StringRef horizontalSwing(determine_swing_horizontal(this->rx_buffer_[34]));
-    StringRef verticalSwing(determine_swing_vertical(this->rx_buffer_[38]));
+    StringRef horizontalSwing(determine_swing_horizontal(frame[34]));
+    StringRef verticalSwing(determine_swing_vertical(frame[38]));
 
     update_swing_horizontal(horizontalSwing);
     update_swing_vertical(verticalSwing);
 
-    bool nanoex = determine_nanoex(this->rx_buffer_[50]);
+    bool nanoex = determine_nanoex(frame[50]);
 
     update_nanoex(nanoex);
 
-    this->set_custom_fan_mode_(determine_fan_speed(this->rx_buffer_[26]));
-    this->set_custom_preset_(determine_preset(this->rx_buffer_[42]));
+    this->set_custom_fan_mode_(determine_fan_speed(frame[26]));
+    this->set_custom_preset_(determine_preset(frame[42]));
 
-    this->swing_mode = determine_swing(this->rx_buffer_[30]);
+    this->swing_mode = determine_swing(frame[30]);
 
     // climate::ClimateAction action = determine_action(); // Determine the current action of the AC
     // this->action = action;
@@ -466,94 +738,34 @@ void PanasonicACWLAN::handle_packet() {
     ESP_LOGV(TAG, "Received command ack");
   } else if (this->rx_buffer_[2] == 0x10 && this->rx_buffer_[3] == 0x0A)  // Report
   {
-    ESP_LOGV(TAG, "Received report");
-    send_command(CMD_REPORT_ACK, sizeof(CMD_REPORT_ACK), CommandType::Response);
+    ESP_LOGV(TAG, "Received report");  // Already acknowledged in acknowledge_packet()
+
+    FrameView frame(this->rx_buffer_);
 
-    if (this->rx_buffer_.size() < 13) {
+    if (frame.size() < 13) {
       ESP_LOGE(TAG, "Report is too short to handle");
       return;
     }
 
-    // 0 = Header & packet type
-    // 1 = Packet length
-    // 2 = Key value pair counter
-    for (int i = 0; i < this->rx_buffer_[10]; i++) {
-      // Offset everything by header, packet length and pair counter (4 * 3)
-      // then offset by pair length (i * 4)
-      int currentIndex = (4 * 3) + (i * 4);
-
-      // 0 = Header
-      // 1 = Data
-      // 2 = Data
-      // 3 = ?
-      switch (this->rx_buffer_[currentIndex]) {
-        case 0x80:  // Power mode
-          switch (this->rx_buffer_[currentIndex + 2]) {
-            case 0x30:  // Power mode on
-              ESP_LOGV(TAG, "Received power mode on");
-              // Ignore power on and let mode be set by other report
-              break;
-            case 0x31:  // Power mode off
-              ESP_LOGV(TAG, "Received power mode off");
-              this->mode = climate::CLIMATE_MODE_OFF;
-              break;
-            default:
-              ESP_LOGW(TAG, "Received unknown power mode");
-              break;
-          }
-          break;
-        case 0xB0:  // Mode
-          this->mode = determine_mode(this->rx_buffer_[currentIndex + 2]);
-          break;
-        case 0x31:  // Target temperature
-          ESP_LOGV(TAG, "Received target temperature");
-          update_target_temperature((int8_t) this->rx_buffer_[currentIndex + 2]);
-          break;
-        case 0xA0:  // Fan speed
-          ESP_LOGV(TAG, "Received fan speed");
-          this->set_custom_fan_mode_(determine_fan_speed(this->rx_buffer_[currentIndex + 2]));
-          break;
-        case 0xB2:  // Preset
-          ESP_LOGV(TAG, "Received preset");
-          this->set_custom_preset_(determine_preset(this->rx_buffer_[currentIndex + 2]));
-          break;
-        case 0xA1:
-          ESP_LOGV(TAG, "Received swing mode");
-          this->swing_mode = determine_swing(this->rx_buffer_[currentIndex + 2]);
-          break;
-        case 0xA5:  // Horizontal swing position
-          ESP_LOGV(TAG, "Received horizontal swing position");
-
-          update_swing_horizontal(StringRef(determine_swing_horizontal(this->rx_buffer_[currentIndex + 2])));
-          break;
-        case 0xA4:  // Vertical swing position
-          ESP_LOGV(TAG, "Received vertical swing position");
-
-          update_swing_vertical(StringRef(determine_swing_vertical(this->rx_buffer_[currentIndex + 2])));
-          break;
-        case 0x33:  // nanoex mode
-          ESP_LOGV(TAG, "Received nanoex state");
-
-          update_nanoex(determine_nanoex(this->rx_buffer_[currentIndex + 2]));
-          break;
-        case 0x20:
-          ESP_LOGV(TAG, "Received unknown nanoex field");
-          // Not sure what this one, ignore it for now
-          break;
-        default:
-          ESP_LOGW(TAG, "Report has unknown field");
-          break;
-      }
-    }
+    decode_fields(frame, FieldSource::Report);
 
     climate::ClimateAction action = determine_action();  // Determine the current action of the AC
     this->action = action;
 
     this->publish_state();
+#ifdef USE_PANASONIC_AC_PASSIVE
+  } else if (this->is_passive() && is_handshake_packet(this->rx_buffer_[2], this->rx_buffer_[3])) {
+    ESP_LOGV(TAG, "Received handshake packet of the official adapter's session");  // Carries no state
+#endif
   } else if (this->rx_buffer_[2] == 0x01 && this->rx_buffer_[3] == 0x80)  // Answer for handshake 16
   {
     ESP_LOGI(TAG, "Panasonic AC component v%s initialized", VERSION);
     this->state_ = ACState::Ready;
+    this->cancel_timer(Timer::InitFail);
+    this->arm_init_timer();
+
+    this->expire_changes();
+    this->resume_command(this->set_queue_index_ > 0);
   } else {
     ESP_LOGW(TAG, "Received unknown packet");
   }
@@ -563,47 +775,47 @@ void PanasonicACWLAN::handle_handshake_packet() {
   if (this->rx_buffer_[2] == 0x00 && this->rx_buffer_[3] == 0x89)  // Answer for handshake 2
   {
     ESP_LOGD(TAG, "Answering handshake [2/16]");
-    send_command(CMD_HANDSHAKE_3, sizeof(CMD_HANDSHAKE_3));
+    queue_response(CMD_HANDSHAKE_3, sizeof(CMD_HANDSHAKE_3), CommandType::Normal);
   } else if (this->rx_buffer_[2] == 0x00 && this->rx_buffer_[3] == 0x8C)  // Answer for handshake 3
   {
     ESP_LOGD(TAG, "Answering handshake [3/16]");
-    send_command(CMD_HANDSHAKE_4, sizeof(CMD_HANDSHAKE_4));
+    queue_response(CMD_HANDSHAKE_4, sizeof(CMD_HANDSHAKE_4), CommandType::Normal);
   } else if (this->rx_buffer_[2] == 0x00 && this->rx_buffer_[3] == 0x90)  // Answer for handshake 4
   {
     ESP_LOGD(TAG, "Answering handshake [4/16]");
-    send_command(CMD_HANDSHAKE_5, sizeof(CMD_HANDSHAKE_5));
+    queue_response(CMD_HANDSHAKE_5, sizeof(CMD_HANDSHAKE_5), CommandType::Normal);
   } else if (this->rx_buffer_[2] == 0x00 && this->rx_buffer_[3] == 0x91)  // Answer for handshake 5
   {
     ESP_LOGD(TAG, "Answering handshake [5/16]");
-    send_command(CMD_HANDSHAKE_6, sizeof(CMD_HANDSHAKE_6));
+    queue_response(CMD_HANDSHAKE_6, sizeof(CMD_HANDSHAKE_6), CommandType::Normal);
   } else if (this->rx_buffer_[2] == 0x00 && this->rx_buffer_[3] == 0x92)  // Answer for handshake 6
   {
     ESP_LOGD(TAG, "Answering handshake [6/16]");
-    send_command(CMD_HANDSHAKE_7, sizeof(CMD_HANDSHAKE_7));
+    queue_response(CMD_HANDSHAKE_7, sizeof(CMD_HANDSHAKE_7), CommandType::Normal);
   } else if (this->rx_buffer_[2] == 0x00 && this->rx_buffer_[3] == 0xC1)  // Answer for handshake 7
   {
     ESP_LOGD(TAG, "Answering handshake [7/16]");
-    send_command(CMD_HANDSHAKE_8, sizeof(CMD_HANDSHAKE_8));
+    queue_response(CMD_HANDSHAKE_8, sizeof(CMD_HANDSHAKE_8), CommandType::Normal);
   } else if (this->rx_buffer_[2] == 0x01 && this->rx_buffer_[3] == 0xCC)  // Answer for handshake 8
   {
     ESP_LOGD(TAG, "Answering handshake [8/16]");
-    send_command(CMD_HANDSHAKE_9, sizeof(CMD_HANDSHAKE_9));
+    queue_response(CMD_HANDSHAKE_9, sizeof(CMD_HANDSHAKE_9), CommandType::Normal);
   } else if (this->rx_buffer_[2] == 0x10 && this->rx_buffer_[3] == 0x80)  // Answer for handshake 9
   {
     ESP_LOGD(TAG, "Answering handshake [9/16]");
-    send_command(CMD_HANDSHAKE_10, sizeof(CMD_HANDSHAKE_10));
+    queue_response(CMD_HANDSHAKE_10, sizeof(CMD_HANDSHAKE_10), CommandType::Normal);
   } else if (this->rx_buffer_[2] == 0x10 && this->rx_buffer_[3] == 0x81)  // Answer for handshake 10
   {
     ESP_LOGD(TAG, "Answering handshake [10/16]");
-    send_command(CMD_HANDSHAKE_11, sizeof(CMD_HANDSHAKE_11));
+    queue_response(CMD_HANDSHAKE_11, sizeof(CMD_HANDSHAKE_11), CommandType::Normal);
   } else if (this->rx_buffer_[2] == 0x00 && this->rx_buffer_[3] == 0x98)  // Answer for handshake 11
   {
     ESP_LOGD(TAG, "Answering handshake [11/16]");
-    send_command(CMD_HANDSHAKE_12, sizeof(CMD_HANDSHAKE_12));
+    queue_response(CMD_HANDSHAKE_12, sizeof(CMD_HANDSHAKE_12), CommandType::Normal);
   } else if (this->rx_buffer_[2] == 0x01 && this->rx_buffer_[3] == 0x80)  // Answer for handshake 12
   {
     ESP_LOGD(TAG, "Answering handshake [12/16]");
-    send_command(CMD_HANDSHAKE_13, sizeof(CMD_HANDSHAKE_13));
+    queue_response(CMD_HANDSHAKE_13, sizeof(CMD_HANDSHAKE_13), CommandType::Normal);
   } else if (this->rx_buffer_[2] == 0x10 && this->rx_buffer_[3] == 0x88)  // Answer for handshake 13
   {
     // Ignore
@@ -613,12 +825,12 @@ void PanasonicACWLAN::handle_handshake_packet() {
   {
     ESP_LOGD(TAG, "Received rx counter [14/16]");
     this->receive_packet_count_ = this->rx_buffer_[1];  // Set rx packet counter
-    send_command(CMD_HANDSHAKE_14, sizeof(CMD_HANDSHAKE_14), CommandType::Response);
+    queue_response(CMD_HANDSHAKE_14, sizeof(CMD_HANDSHAKE_14));
   } else if (this->rx_buffer_[2] == 0x00 && this->rx_buffer_[3] == 0x20)  // Second unsolicited packet from AC
   {
     ESP_LOGD(TAG, "Answering handshake [15/16]");
     this->state_ = ACState::FirstPoll;  // Start delayed first poll
-    send_command(CMD_HANDSHAKE_15, sizeof(CMD_HANDSHAKE_15), CommandType::Response);
+    queue_response(CMD_HANDSHAKE_15, sizeof(CMD_HANDSHAKE_15));
   } else {
     ESP_LOGW(TAG, "Received unknown packet during initialization");
   }
@@ -650,9 +862,9 @@ void PanasonicACWLAN::send_set_command() {
   packet[11] = 0x00;
 
   for (int i = 0; i < this->set_queue_index_; i++) {
-    packet[12 + (i * 4) + 0] = this->set_queue_[i][0];  // Key
-    packet[12 + (i * 4) + 1] = 0x01;                    // Unknown, always 0x01
-    packet[12 + (i * 4) + 2] = this->set_queue_[i][1];  // Value
+    packet[12 + (i * 4) + 0] = this->set_queue_[i].key;    // Key
+    packet[12 + (i * 4) + 1] = 0x01;                       // Unknown, always 0x01
+    packet[12 + (i * 4) + 2] = this->set_queue_[i].value;  // Value
     packet[12 + (i * 4) + 3] =
         0x00;  // Unknown, either 0x00 or 0x01 or 0x02; overwritten by checksum on last key value pair
   }
@@ -664,13 +876,15 @@ void PanasonicACWLAN::send_set_command() {
 void PanasonicACWLAN::send_command(const uint8_t *command, size_t commandLength, CommandType type) {
   std::vector<uint8_t> packet(commandLength + 3);  // Reserve space for upcoming packet
 
-  for (int i = 0; i < commandLength; i++)  // Loop through command
+  for (size_t i = 0; i < commandLength; i++)  // Loop through command
   {
     packet[i + 2] = command[i];  // Add to packet
   }
 
-  this->last_command_ = command;               // Store the last command we sent
-  this->last_command_length_ = commandLength;  // Store the length of the last command we sent
+  if (type != CommandType::Response) {          // Responses are never resent
+    this->last_command_ = command;               // Store the last command we sent
+    this->last_command_length_ = commandLength;  // Store the length of the last command we sent
+  }
 
   send_packet(packet, type);  // Actually send the constructed packet
 }
@@ -678,9 +892,6 @@ void PanasonicACWLAN::send_command(const uint8_t *command, size_t commandLength,
 void PanasonicACWLAN::send_packet(std::vector<uint8_t> packet, CommandType type) {
   uint8_t length = packet.size();
 
-  uint8_t checksum = 0;  // Checksum is calculated by adding all bytes together
-  packet[0] = HEADER;    // Write header to packet
-
   uint8_t packetCount = this->transmit_packet_count_;  // Set packet counter
 
   if (type == CommandType::Response)
@@ -689,33 +900,23 @@ void PanasonicACWLAN::send_packet(std::vector<uint8_t> packet, CommandType type)
     packetCount = this->transmit_packet_count_ -
                   1;  // Set the packet counter to the tx counter -1 (we are sending the same packet again)
 
-  packet[1] = packetCount;  // Write to packet
-
-  for (uint8_t i : packet)  // Loop through payload to calculate checksum
-  {
-    checksum += i;  // Add byte to checksum
-  }
-
-  checksum = (~checksum + 1);     // Compute checksum
-  packet[length - 1] = checksum;  // Add checksum to end of packet
+  seal_frame(packet.data(), length, packetCount);  // Write header, packet counter and checksum
 
-  this->last_packet_sent_ = millis();  // Save the time when we sent the last packet
+  this->last_packet_sent_ = this->now_ms();  // Save the time when we sent the last packet
+  this->transmit_spacing_ = (length * BYTE_TIME_US) / 1000 + FRAME_SPACING;
 
   if (type == CommandType::Normal)  // Do not increase tx counter if this was a response or if this was a resent packet
-  {
-    if (this->transmit_packet_count_ == 0xFE)
-      this->transmit_packet_count_ = 0x01;  // Special case, roll over transmit counter after 0xFE
-    else
-      this->transmit_packet_count_++;  // Increase tx packet counter if this wasn't a response
-  } else if (type == CommandType::Response) {
-    if (this->receive_packet_count_ == 0xFE)
-      this->receive_packet_count_ = 0x01;  // Special case, roll over receive counter after 0xFE
-    else
-      this->receive_packet_count_++;  // Increase rx counter if this was a response
-  }
+    this->transmit_packet_count_ = next_counter(this->transmit_packet_count_);
+  else if (type == CommandType::Response)
+    this->receive_packet_count_ = next_counter(this->receive_packet_count_);  // Increase rx counter for responses
 
-  if (type != CommandType::Response)     // Don't wait for a response for responses
+  if (type != CommandType::Response) {   // Don't wait for a response for responses
     this->waiting_for_response_ = true;  // Mark that we are waiting for a response
+    this->arm_timer(Timer::Resend, this->last_packet_sent_, RESPONSE_TIMEOUT);
+  }
+
+  this->arm_timer(Timer::Poll, this->last_packet_sent_, POLL_INTERVAL);
+  this->arm_init_timer();  // Initialization timeouts are relative to the last packet sent
 
   write_array(packet);       // Write to UART
   log_packet(packet, true);  // Write to log
@@ -724,141 +925,89 @@ void PanasonicACWLAN::send_packet(std::vector<uint8_t> packet, CommandType type)
 /*
  * Helpers
  */
-void PanasonicACWLAN::handle_resend() {
-  if (this->waiting_for_response_ && millis() - this->last_packet_sent_ > RESPONSE_TIMEOUT &&
+bool PanasonicACWLAN::handle_resend() {
+  if (this->waiting_for_response_ && this->is_timer_due(Timer::Resend) &&
       this->rx_buffer_.empty())  // Check if AC failed to respond in time and resend packet, if nothing was received yet
   {
     ESP_LOGD(TAG, "Resending previous packet");
     send_command(this->last_command_, this->last_command_length_, CommandType::Resend);
+    return true;
   }
+
+  return false;
 }
 
 void PanasonicACWLAN::set_value(uint8_t key, uint8_t value) {
+  uint32_t now = this->now_ms();
+
+  for (int i = 0; i < this->set_queue_index_; i++) {
+    if (this->set_queue_[i].key == key) {
+      this->set_queue_[i].value = value;  // Key is already queued, only the latest value is sent
+      this->set_queue_[i].changed = now;
+      return;
+    }
+  }
+
   if (this->set_queue_index_ >= 15) {
     ESP_LOGE(TAG, "Set queue overflow");
     this->set_queue_index_ = 0;
     return;
   }
 
-  this->set_queue_[this->set_queue_index_][0] = key;
-  this->set_queue_[this->set_queue_index_][1] = value;
+  this->set_queue_[this->set_queue_index_] = {key, value, now};
   this->set_queue_index_++;
 }
 
+/*
+ * Drops the queued values that are too old to be sent, keeping the order of the remaining ones
+ */
+void PanasonicACWLAN::expire_changes() {
+  uint8_t kept = 0;
+
+  for (uint8_t i = 0; i < this->set_queue_index_; i++) {
+    if (!this->is_change_expired(this->set_queue_[i].changed))
+      this->set_queue_[kept++] = this->set_queue_[i];
+  }
+
+  this->set_queue_index_ = kept;
+}
+
 /*
  * Sensor handling
  */
 
 void PanasonicACWLAN::on_vertical_swing_change(const StringRef& swing) {
-  if (this->state_ != ACState::Ready)
-    return;
-
   ESP_LOGD(TAG, "Setting vertical swing position");
 
-  if (swing == "down")
-    set_value(0xA4, 0x42);
-  else if (swing == "down_center")
-    set_value(0xA4, 0x45);
-  else if (swing == "center")
-    set_value(0xA4, 0x43);
-  else if (swing == "up_center")
-    set_value(0xA4, 0x44);
-  else if (swing == "up")
-    set_value(0xA4, 0x41);
+  const NamedValue *position = find_name(VERTICAL_SWINGS, swing);
 
-  send_set_command();
+  if (position != nullptr)
+    set_value(KEY_VERTICAL_SWING, position->value);
+
+  this->schedule_command();
 }
 
 void PanasonicACWLAN::on_horizontal_swing_change(const StringRef &swing) {
-  if (this->state_ != ACState::Ready)
-    return;
-
   ESP_LOGD(TAG, "Setting horizontal swing position");
 
-  if (swing == "left")
-    set_value(0xA5, 0x42);
-  else if (swing == "left_center")
-    set_value(0xA5, 0x5C);
-  else if (swing == "center")
-    set_value(0xA5, 0x43);
-  else if (swing == "right_center")
-    set_value(0xA5, 0x56);
-  else if (swing == "right")
-    set_value(0xA5, 0x41);
+  const NamedValue *position = find_name(HORIZONTAL_SWINGS, swing);
 
-  send_set_command();
+  if (position != nullptr)
+    set_value(KEY_HORIZONTAL_SWING, position->value);
+
+  this->schedule_command();
 }
 
 void PanasonicACWLAN::on_nanoex_change(bool state) {
-  if (this->state_ != ACState::Ready)
-    return;
-
   if (state) {
     ESP_LOGV(TAG, "Turning nanoex on");
-    set_value(0x33, 0x45);  // nanoeX on
+    set_value(KEY_NANOEX, VALUE_ON);
   } else {
     ESP_LOGV(TAG, "Turning nanoex off");
-    set_value(0x33, 0x42);  // nanoeX off
+    set_value(KEY_NANOEX, VALUE_OFF);
   }
 
-  send_set_command();
-}
-
-void PanasonicACWLAN::on_eco_change(bool state) {
-  if (this->state_ != ACState::Ready)
-    return;
-
-  return;
-
-  // TODO: implement eco
-
-  // if (state) {
-  //   ESP_LOGV(TAG, "Turning eco on");
-  //   set_value(..., ...);  // eco on
-  // } else {
-  //   ESP_LOGV(TAG, "Turning eco off");
-  //   set_value(..., ...);  // eco off
-  // }
-
-  // send_set_command();
-}
-
-void PanasonicACWLAN::on_econavi_change(bool state) {
-  if (this->state_ != ACState::Ready)
-    return;
-
-  return;
-
-  // TODO: implement econavi
-
-  // if (state) {
-  //   ESP_LOGV(TAG, "Turning econavi on");
-  //   set_value(..., ...);  // econavi on
-  // } else {
-  //   ESP_LOGV(TAG, "Turning econavi off");
-  //   set_value(..., ...);  // econavi off
-  // }
-
-  // send_set_command();
-}
-
-void PanasonicACWLAN::on_mild_dry_change(bool state) {
-  if (this->state_ != ACState::Ready)
-    return;
-
-  return;
-
-  // TODO: implement mild_dry
-
-  // if (state) {
-  //   ESP_LOGV(TAG, "Turning mild_dry on");
-  //   set_value(..., ...);  // mild_dry on
-  // } else {
-  //   ESP_LOGV(TAG, "Turning mild_dry off");
-  //   set_value(..., ...);  // mild_dry off
-  // }
-
-  // send_set_command();
+  this->schedule_command();
 }
 
 }  // namespace WLAN
@@ -1,19 +1,61 @@
+#pragma once
+
 #include "esphome/components/climate/climate.h"
 #include "esphome/components/climate/climate_mode.h"
 #include "esppac.h"
+#include "esppac_unknown_fields.h"
+
+#ifdef USE_PANASONIC_AC_UNKNOWN_FIELDS_SENSOR
+#include "esphome/components/text_sensor/text_sensor.h"
+#endif
 
 namespace esphome {
 namespace panasonic_ac {
 namespace WLAN {
 
-static const uint8_t HEADER = 0x5A;  // The header of the protocol, every packet starts with this
+static const int INIT_TIMEOUT = 10000;         // Time to wait before initializing after boot
+static const int INIT_END_TIMEOUT = 10000;     // Time to wait for last handshake packet
+static const int FIRST_POLL_TIMEOUT = 650;     // Time to wait before requesting the first poll
+static const int POLL_INTERVAL = 30000;        // The interval at which to poll the AC
+static const int RESPONSE_TIMEOUT = 600;       // The timeout after which we expect a response to our last command
+static const int INIT_FAIL_TIMEOUT = 30000;    // The timeout after which the initialization is considered failed
+static const int BYTE_TIME_US = 1146;          // Time to transmit one byte (11 bits, 8E1) at 9600 baud
+static const int FRAME_SPACING = 10;           // Minimum idle time between the end of a packet and the next one we send
+static const uint8_t RESPONSE_QUEUE_SIZE = 4;  // Maximum number of responses waiting to be sent
+static const uint8_t REPORT_WINDOW_SIZE = 4;   // Number of recent reports remembered to detect resent ones
+static const uint8_t UNKNOWN_FIELD_SLOTS = 8;  // Number of unknown report keys tracked
+static const uint32_t UNKNOWN_FIELD_SUMMARY_INTERVAL = 600000;  // Minimum time between two summaries of unknown keys
+
+/*
+ * A key/value pair waiting to be sent in a set command
+ */
+struct PendingValue {
+  uint8_t key;
+  uint8_t value;
+  uint32_t changed;  // Time at which the value was last changed
+};
+
+/*
+ * A packet waiting for the line to be free, sent before any request
+ */
+struct PendingResponse {
+  const uint8_t *command;
+  size_t length;
+  CommandType type;  // Response for answers to the AC, Normal for handshake steps that expect an answer
+};
+
+/*
+ * A report received from the AC, identified by its rx counter and a hash of its payload
+ */
+struct SeenReport {
+  uint8_t counter;
+  uint32_t hash;
+};
 
-static const int INIT_TIMEOUT = 10000;       // Time to wait before initializing after boot
-static const int INIT_END_TIMEOUT = 10000;   // Time to wait for last handshake packet
-static const int FIRST_POLL_TIMEOUT = 650;   // Time to wait before requesting the first poll
-static const int POLL_INTERVAL = 30000;      // The interval at which to poll the AC
-static const int RESPONSE_TIMEOUT = 600;     // The timeout after which we expect a response to our last command
-static const int INIT_FAIL_TIMEOUT = 30000;  // The timeout after which the initialization is considered failed
+enum class FieldSource {
+  Report,     // Sent by the AC, unknown keys are tracked
+  SetCommand  // Sent by the official adapter in passive mode, its keys are not report fields
+};
 
 enum class ACState {
   Initializing,     // Before first handshake packet is sent
@@ -24,19 +66,21 @@ enum class ACState {
   Failed            // Initialization failed
 };
 
-class PanasonicACWLAN : public PanasonicAC {
+class PanasonicACWLAN : public PanasonicACDriver<PanasonicACWLAN> {
  public:
   void control(const climate::ClimateCall &call) override;
 
-  void on_horizontal_swing_change(const StringRef &swing) override;
-  void on_vertical_swing_change(const StringRef &swing) override;
-  void on_nanoex_change(bool nanoex) override;
-  void on_eco_change(bool eco) override;
-  void on_econavi_change(bool eco) override;
-  void on_mild_dry_change(bool mild_dry) override;
+  void on_horizontal_swing_change(const StringRef &swing);
+  void on_vertical_swing_change(const StringRef &swing);
+  void on_nanoex_change(bool nanoex);  // Eco, econavi and mild dry are not supported via CN-WLAN yet
+
+#ifdef USE_PANASONIC_AC_UNKNOWN_FIELDS_SENSOR
+  void set_unknown_fields_sensor(text_sensor::TextSensor *unknown_fields_sensor);
+#endif
 
   void setup() override;
   void loop() override;
+  void dump_config() override;
 
  protected:
   ACState state_ = ACState::Initializing;  // Stores the internal state of the AC, used during initialization
@@ -47,23 +91,56 @@ class PanasonicACWLAN : public PanasonicAC {
   const uint8_t *last_command_;  // Stores a pointer to the last command we executed
   size_t last_command_length_;   // Stores the length of the last command we executed
 
-  uint8_t set_queue_[16][2];     // Queue to store the key/value for the set commands
+  PendingValue set_queue_[16];   // Queue to store the key/value for the set commands
   uint8_t set_queue_index_ = 0;  // Stores the index of the next key/value set
 
+  PendingResponse response_queue_[RESPONSE_QUEUE_SIZE];  // Responses and handshake steps waiting for the line
+  uint8_t response_count_ = 0;                           // Number of responses waiting to be sent
+  uint32_t transmit_spacing_ = 0;                        // Time after the last packet sent before the next one
+
+  SeenReport seen_reports_[REPORT_WINDOW_SIZE];  // Sliding window of the latest reports
+  uint8_t seen_report_index_ = 0;                // Next slot to overwrite in the window
+  uint8_t seen_report_count_ = 0;                // Number of valid slots in the window
+  uint32_t reports_received_ = 0;                // Number of reports received
+  uint32_t reports_duplicate_ = 0;               // Number of reports that were resent by the AC
+
+  UnknownFieldRegistry<UNKNOWN_FIELD_SLOTS> unknown_fields_;  // Report keys the decoder does not know
+  uint32_t last_unknown_field_summary_ = 0;                   // Stores the time of the last summary of unknown keys
+#ifdef USE_PANASONIC_AC_UNKNOWN_FIELDS_SENSOR
+  text_sensor::TextSensor *unknown_fields_sensor_ = nullptr;  // Text sensor to publish the unknown keys to
+#endif
+
   void handle_init_packets();
+  void arm_init_timer();
   void handle_handshake_packet();
 
-  void handle_poll();
+  bool handle_poll();
+  bool handle_cmd();
   bool verify_packet();
+  void acknowledge_packet();
+  bool is_recent_counter(uint8_t counter);
+  bool is_duplicate_report();
   void handle_packet();
+  void decode_fields(FrameView frame, FieldSource source);
+#ifdef USE_PANASONIC_AC_PASSIVE
+  void handle_controller_packet();
+#endif
+  void record_unknown_field(uint8_t key, uint8_t value);
+  void publish_unknown_fields();
+
+  void handle_transmit();
+  bool can_transmit();
+  void queue_response(const uint8_t *command, size_t length, CommandType type = CommandType::Response);
+  bool send_response();
 
   void send_set_command();
   void send_command(const uint8_t *command, size_t commandLength, CommandType type = CommandType::Normal);
   void send_packet(std::vector<uint8_t> packet, CommandType type = CommandType::Normal);
 
-  void handle_resend();
+  bool handle_resend();
 
   void set_value(uint8_t key, uint8_t value);
+  void expire_changes();
 };
 
 }  // namespace WLAN
@@ -7,8 +7,17 @@ namespace esphome {
 namespace panasonic_ac {
 
 class PanasonicACSelect : public select::Select, public Component {
+ public:
+  void set_read_only(bool read_only) { this->read_only_ = read_only; }  // Passive mode, changes are dropped
+
  protected:
-  void control(const std::string &value) override { this->publish_state(value); }
+  void control(const std::string &value) override {
+    if (this->read_only_)
+      return;  // Keeps the state observed on the line
+    this->publish_state(value);
+  }
+
+  bool read_only_ = false;
 };
 
 }  // namespace panasonic_ac
@@ -7,8 +7,17 @@ namespace esphome {
 namespace panasonic_ac {
 
 class PanasonicACSwitch : public switch_::Switch, public Component {
+ public:
+  void set_read_only(bool read_only) { this->read_only_ = read_only; }  // Passive mode, changes are dropped
+
  protected:
-  void write_state(bool state) override { this->publish_state(state); }
+  void write_state(bool state) override {
+    if (this->read_only_)
+      return;  // Keeps the state observed on the line
+    this->publish_state(state);
+  }
+
+  bool read_only_ = false;
 };
 
 }  // namespace panasonic_ac
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+namespace binary_sensor {
+
+class BinarySensor : public EntityBase {
+ public:
+  bool state{false};
+
+  void publish_state(bool state) {
+    this->state = state;
+    this->state_callback_.call(state);
+  }
+
+  void add_on_state_callback(std::function<void(bool)> &&callback) {
+    this->state_callback_.add(std::move(callback));
+  }
+
+ protected:
+  CallbackManager<void(bool)> state_callback_;
+};
+
+}  // namespace binary_sensor
+}  // namespace esphome
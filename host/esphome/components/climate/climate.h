@@ -0,0 +1,162 @@
+#pragma once
+
+#include <cmath>
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+#include "esphome/components/climate/climate_mode.h"
+#include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+namespace climate {
+
+class ClimateTraits {
+ public:
+  void add_feature_flags(uint32_t flags) { this->feature_flags_ |= flags; }
+  uint32_t get_feature_flags() const { return this->feature_flags_; }
+
+  void set_visual_min_temperature(float temperature) { this->visual_min_temperature_ = temperature; }
+  void set_visual_max_temperature(float temperature) { this->visual_max_temperature_ = temperature; }
+  void set_visual_temperature_step(float step) { this->visual_temperature_step_ = step; }
+  float get_visual_min_temperature() const { return this->visual_min_temperature_; }
+  float get_visual_max_temperature() const { return this->visual_max_temperature_; }
+  float get_visual_temperature_step() const { return this->visual_temperature_step_; }
+
+  void set_supported_modes(std::initializer_list<ClimateMode> modes) {
+    this->supported_modes_ = 0;
+    for (ClimateMode mode : modes)
+      this->add_supported_mode(mode);
+  }
+  void add_supported_mode(ClimateMode mode) { this->supported_modes_ |= 1 << mode; }
+  bool supports_mode(ClimateMode mode) const { return (this->supported_modes_ & (1 << mode)) != 0; }
+
+  void set_supported_swing_modes(std::initializer_list<ClimateSwingMode> swing_modes) {
+    this->supported_swing_modes_ = 0;
+    for (ClimateSwingMode swing_mode : swing_modes)
+      this->add_supported_swing_mode(swing_mode);
+  }
+  void add_supported_swing_mode(ClimateSwingMode swing_mode) { this->supported_swing_modes_ |= 1 << swing_mode; }
+  bool supports_swing_mode(ClimateSwingMode swing_mode) const {
+    return (this->supported_swing_modes_ & (1 << swing_mode)) != 0;
+  }
+
+ protected:
+  uint32_t feature_flags_ = 0;
+  uint32_t supported_modes_ = 0;
+  uint32_t supported_swing_modes_ = 0;
+  float visual_min_temperature_ = 10;
+  float visual_max_temperature_ = 30;
+  float visual_temperature_step_ = 0.1f;
+};
+
+class Climate;
+
+/*
+ * Change request, built with the setters and handed to Climate::control() by perform()
+ */
+class ClimateCall {
+ public:
+  explicit ClimateCall(Climate *parent) : parent_(parent) {}
+
+  ClimateCall &set_mode(ClimateMode mode) {
+    this->mode_ = mode;
+    return *this;
+  }
+  ClimateCall &set_target_temperature(float target_temperature) {
+    this->target_temperature_ = target_temperature;
+    return *this;
+  }
+  ClimateCall &set_swing_mode(ClimateSwingMode swing_mode) {
+    this->swing_mode_ = swing_mode;
+    return *this;
+  }
+  ClimateCall &set_fan_mode(const std::string &custom_fan_mode) {
+    this->custom_fan_mode_ = custom_fan_mode;
+    return *this;
+  }
+  ClimateCall &set_preset(const std::string &custom_preset) {
+    this->custom_preset_ = custom_preset;
+    return *this;
+  }
+
+  const optional<ClimateMode> &get_mode() const { return this->mode_; }
+  const optional<float> &get_target_temperature() const { return this->target_temperature_; }
+  const optional<ClimateSwingMode> &get_swing_mode() const { return this->swing_mode_; }
+  bool has_custom_fan_mode() const { return this->custom_fan_mode_.has_value(); }
+  StringRef get_custom_fan_mode() const { return StringRef(this->custom_fan_mode_ ? this->custom_fan_mode_->c_str() : ""); }
+  bool has_custom_preset() const { return this->custom_preset_.has_value(); }
+  StringRef get_custom_preset() const { return StringRef(this->custom_preset_ ? this->custom_preset_->c_str() : ""); }
+
+  void perform();
+
+ protected:
+  Climate *parent_;
+  optional<ClimateMode> mode_;
+  optional<float> target_temperature_;
+  optional<ClimateSwingMode> swing_mode_;
+  optional<std::string> custom_fan_mode_;
+  optional<std::string> custom_preset_;
+};
+
+class Climate : public EntityBase {
+  friend class ClimateCall;
+
+ public:
+  ClimateMode mode{CLIMATE_MODE_OFF};
+  ClimateAction action{CLIMATE_ACTION_OFF};
+  ClimateSwingMode swing_mode{CLIMATE_SWING_OFF};
+  float current_temperature{NAN};
+  float target_temperature{NAN};
+
+  ClimateCall make_call() { return ClimateCall(this); }
+
+  void publish_state() { this->state_callback_.call(*this); }
+  void add_on_state_callback(std::function<void(Climate &)> &&callback) {
+    this->state_callback_.add(std::move(callback));
+  }
+
+  ClimateTraits get_traits() { return this->traits(); }
+
+  void set_supported_custom_fan_modes(std::initializer_list<const char *> modes) {
+    this->supported_custom_fan_modes_.assign(modes.begin(), modes.end());
+  }
+  void set_supported_custom_presets(std::initializer_list<const char *> presets) {
+    this->supported_custom_presets_.assign(presets.begin(), presets.end());
+  }
+  const std::vector<std::string> &get_supported_custom_fan_modes() const { return this->supported_custom_fan_modes_; }
+  const std::vector<std::string> &get_supported_custom_presets() const { return this->supported_custom_presets_; }
+
+  bool has_custom_fan_mode() const { return this->custom_fan_mode_.has_value(); }
+  StringRef get_custom_fan_mode() const { return StringRef(this->custom_fan_mode_ ? this->custom_fan_mode_->c_str() : ""); }
+  bool has_custom_preset() const { return this->custom_preset_.has_value(); }
+  StringRef get_custom_preset() const { return StringRef(this->custom_preset_ ? this->custom_preset_->c_str() : ""); }
+
+ protected:
+  // Return true if the value changed
+  bool set_custom_fan_mode_(const char *mode) { return set_optional_(this->custom_fan_mode_, mode); }
+  bool set_custom_preset_(const char *preset) { return set_optional_(this->custom_preset_, preset); }
+
+  virtual void control(const ClimateCall &call) = 0;
+  virtual ClimateTraits traits() = 0;
+
+  static bool set_optional_(optional<std::string> &value, const char *text) {
+    if (value.has_value() && *value == text)
+      return false;
+    value = text;
+    return true;
+  }
+
+  CallbackManager<void(Climate &)> state_callback_;
+  std::vector<std::string> supported_custom_fan_modes_;
+  std::vector<std::string> supported_custom_presets_;
+  optional<std::string> custom_fan_mode_;
+  optional<std::string> custom_preset_;
+};
+
+inline void ClimateCall::perform() { this->parent_->control(*this); }
+
+}  // namespace climate
+}  // namespace esphome
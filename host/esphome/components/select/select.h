@@ -0,0 +1,93 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+namespace select {
+
+class SelectTraits {
+ public:
+  void set_options(std::vector<std::string> options) { this->options_ = std::move(options); }
+  const std::vector<std::string> &get_options() const { return this->options_; }
+
+ protected:
+  std::vector<std::string> options_;
+};
+
+class Select;
+
+class SelectCall {
+ public:
+  explicit SelectCall(Select *parent) : parent_(parent) {}
+
+  SelectCall &set_option(const std::string &option) {
+    this->option_ = option;
+    return *this;
+  }
+
+  void perform();
+
+ protected:
+  Select *parent_;
+  optional<std::string> option_;
+};
+
+class Select : public EntityBase {
+  friend class SelectCall;
+
+ public:
+  SelectTraits traits;
+
+  SelectCall make_call() { return SelectCall(this); }
+
+  void publish_state(const std::string &option) {
+    auto index = this->index_of(option.c_str());
+    if (index.has_value())
+      this->publish_state(*index);
+  }
+  void publish_state(size_t index) {
+    this->active_index_ = index;
+    this->state_callback_.call(index);
+  }
+
+  size_t size() const { return this->traits.get_options().size(); }
+  bool has_state() const { return this->active_index_.has_value(); }
+  optional<size_t> active_index() const { return this->active_index_; }
+  StringRef current_option() const {
+    return this->active_index_.has_value() ? StringRef(this->traits.get_options()[*this->active_index_])
+                                           : StringRef();
+  }
+
+  optional<size_t> index_of(const char *option) const {
+    const auto &options = this->traits.get_options();
+    for (size_t i = 0; i < options.size(); i++) {
+      if (options[i] == option)
+        return i;
+    }
+    return {};
+  }
+  optional<size_t> index_of(const StringRef &option) const { return this->index_of(option.c_str()); }
+  optional<size_t> index_of(const std::string &option) const { return this->index_of(option.c_str()); }
+
+  void add_on_state_callback(std::function<void(size_t)> &&callback) {
+    this->state_callback_.add(std::move(callback));
+  }
+
+ protected:
+  virtual void control(const std::string &value) = 0;
+
+  optional<size_t> active_index_;
+  CallbackManager<void(size_t)> state_callback_;
+};
+
+inline void SelectCall::perform() {
+  if (this->option_.has_value() && this->parent_->index_of(*this->option_).has_value())
+    this->parent_->control(*this->option_);
+}
+
+}  // namespace select
+}  // namespace esphome
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cmath>
+
+#include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+namespace sensor {
+
+class Sensor : public EntityBase {
+ public:
+  float state{NAN};
+
+  void publish_state(float state) {
+    this->state = state;
+    this->has_state_ = true;
+    this->state_callback_.call(state);
+  }
+
+  bool has_state() const { return this->has_state_; }
+
+  void add_on_state_callback(std::function<void(float)> &&callback) {
+    this->state_callback_.add(std::move(callback));
+  }
+
+ protected:
+  bool has_state_ = false;
+  CallbackManager<void(float)> state_callback_;
+};
+
+}  // namespace sensor
+}  // namespace esphome
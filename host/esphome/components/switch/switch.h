@@ -0,0 +1,33 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+namespace switch_ {
+
+class Switch : public EntityBase {
+ public:
+  bool state{false};
+
+  void turn_on() { this->write_state(true); }
+  void turn_off() { this->write_state(false); }
+  void toggle() { this->write_state(!this->state); }
+
+  void publish_state(bool state) {
+    this->state = state;
+    this->state_callback_.call(state);
+  }
+
+  void add_on_state_callback(std::function<void(bool)> &&callback) {
+    this->state_callback_.add(std::move(callback));
+  }
+
+ protected:
+  virtual void write_state(bool state) = 0;
+
+  CallbackManager<void(bool)> state_callback_;
+};
+
+}  // namespace switch_
+}  // namespace esphome
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <string>
+
+#include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+namespace text_sensor {
+
+class TextSensor : public EntityBase {
+ public:
+  std::string state;
+
+  void publish_state(const std::string &state) {
+    this->state = state;
+    this->state_callback_.call(state);
+  }
+
+  void add_on_state_callback(std::function<void(std::string)> &&callback) {
+    this->state_callback_.add(std::move(callback));
+  }
+
+ protected:
+  CallbackManager<void(std::string)> state_callback_;
+};
+
+}  // namespace text_sensor
+}  // namespace esphome
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <vector>
+
+#include <poll.h>
+#include <unistd.h>
+
+#include "esphome/core/component.h"
+
+namespace esphome {
+namespace uart {
+
+/*
+ * Bus interface, implemented by FifoUART and FileUART below
+ */
+class UARTComponent {
+ public:
+  virtual ~UARTComponent() = default;
+
+  virtual void write_array(const uint8_t *data, size_t length) = 0;
+  virtual bool read_array(uint8_t *data, size_t length) = 0;
+  virtual int available() = 0;
+  virtual void flush() {}
+
+  bool read_byte(uint8_t *data) { return this->read_array(data, 1); }
+};
+
+/*
+ * In-memory UART: bytes pushed with receive() are read by the component, bytes it writes go to the write callback
+ */
+class FifoUART : public UARTComponent {
+ public:
+  using WriteCallback = std::function<void(const uint8_t *data, size_t length)>;
+
+  void set_write_callback(WriteCallback callback) { this->write_callback_ = std::move(callback); }
+
+  void receive(const uint8_t *data, size_t length) { this->rx_.insert(this->rx_.end(), data, data + length); }
+  void receive(const std::vector<uint8_t> &data) { this->receive(data.data(), data.size()); }
+
+  void write_array(const uint8_t *data, size_t length) override {
+    if (this->write_callback_)
+      this->write_callback_(data, length);
+  }
+
+  bool read_array(uint8_t *data, size_t length) override {
+    if (this->rx_.size() < length)
+      return false;
+
+    for (size_t i = 0; i < length; i++) {
+      data[i] = this->rx_.front();
+      this->rx_.pop_front();
+    }
+
+    return true;
+  }
+
+  int available() override { return (int) this->rx_.size(); }
+
+ protected:
+  std::deque<uint8_t> rx_;
+  WriteCallback write_callback_;
+};
+
+/*
+ * UART on a non-blocking file descriptor, a serial port or a pty. Bytes are read from it whenever the component asks
+ * how many are available, writes block until the whole frame is handed to the kernel.
+ */
+class FileUART : public FifoUART {
+ public:
+  explicit FileUART(int fd) : fd_(fd) {}
+
+  int get_fd() const { return this->fd_; }
+
+  void write_array(const uint8_t *data, size_t length) override {
+    while (length > 0) {
+      ssize_t written = ::write(this->fd_, data, length);
+
+      if (written < 0) {
+        struct pollfd writable = {this->fd_, POLLOUT, 0};
+        if (::poll(&writable, 1, 100) < 0)
+          return;
+        continue;
+      }
+
+      data += written;
+      length -= written;
+    }
+  }
+
+  int available() override {
+    uint8_t buffer[256];
+    ssize_t length;
+
+    while ((length = ::read(this->fd_, buffer, sizeof(buffer))) > 0)
+      this->receive(buffer, length);
+
+    return FifoUART::available();
+  }
+
+ protected:
+  int fd_;
+};
+
+class UARTDevice {
+ public:
+  UARTDevice() = default;
+  explicit UARTDevice(UARTComponent *parent) : parent_(parent) {}
+
+  void set_uart_parent(UARTComponent *parent) { this->parent_ = parent; }
+
+  void write_array(const uint8_t *data, size_t length) { this->parent_->write_array(data, length); }
+  void write_array(const std::vector<uint8_t> &data) { this->parent_->write_array(data.data(), data.size()); }
+  bool read_array(uint8_t *data, size_t length) { return this->parent_->read_array(data, length); }
+  bool read_byte(uint8_t *data) { return this->parent_->read_byte(data); }
+  int available() { return this->parent_->available(); }
+  void flush() { this->parent_->flush(); }
+
+ protected:
+  UARTComponent *parent_{nullptr};
+};
+
+}  // namespace uart
+}  // namespace esphome
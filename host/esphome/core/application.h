@@ -0,0 +1,14 @@
+#pragma once
+
+#include "esphome/core/component.h"
+
+namespace esphome {
+
+class Application {
+ public:
+  void safe_reboot();  // Only flags the request, see host::reboot_requested()
+};
+
+extern Application App;
+
+}  // namespace esphome
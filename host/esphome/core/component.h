@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "esphome/core/defines.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+
+namespace setup_priority {
+static const float BUS = 1000.0f;
+static const float HARDWARE = 800.0f;
+static const float DATA = 600.0f;
+}  // namespace setup_priority
+
+/*
+ * Only the lifecycle and the failed state, the host programs call setup() and loop() themselves
+ */
+class Component {
+ public:
+  virtual ~Component() = default;
+
+  virtual void setup() {}
+  virtual void loop() {}
+  virtual void dump_config() {}
+  virtual float get_setup_priority() const { return setup_priority::DATA; }
+
+  void mark_failed() { this->failed_ = true; }
+  bool is_failed() const { return this->failed_; }
+
+  void status_set_warning(const char * /*message*/ = nullptr) { this->warning_ = true; }
+  void status_clear_warning() { this->warning_ = false; }
+  bool status_has_warning() const { return this->warning_; }
+
+ protected:
+  bool failed_ = false;
+  bool warning_ = false;
+};
+
+class EntityBase {
+ public:
+  const StringRef get_name() const { return StringRef(this->name_); }
+  void set_name(const std::string &name) { this->name_ = name; }
+
+  bool is_internal() const { return this->internal_; }
+  void set_internal(bool internal) { this->internal_ = internal; }
+
+  uint32_t get_object_id_hash() { return fnv1_hash(this->name_); }
+
+ protected:
+  std::string name_;
+  bool internal_ = false;
+};
+
+}  // namespace esphome
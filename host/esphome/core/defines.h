@@ -0,0 +1,3 @@
+#pragma once
+
+// The feature defines of the component are passed on the compiler command line, see CMakeLists.txt
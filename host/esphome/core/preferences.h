@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+
+/*
+ * Preference stored in process memory under its key
+ */
+class ESPPreferenceObject {
+ public:
+  ESPPreferenceObject() = default;
+  ESPPreferenceObject(uint32_t key, size_t size) : key_(key), size_(size) {}
+
+  template<typename T> bool save(const T *src) { return this->save_(src, sizeof(T)); }
+  template<typename T> bool load(T *dest) { return this->load_(dest, sizeof(T)); }
+
+ protected:
+  bool save_(const void *data, size_t size);
+  bool load_(void *data, size_t size);
+
+  uint32_t key_ = 0;
+  size_t size_ = 0;
+};
+
+class ESPPreferences {
+ public:
+  template<typename T> ESPPreferenceObject make_preference(uint32_t type, bool in_flash) {
+    return this->make_preference_(type, sizeof(T), in_flash);
+  }
+  template<typename T> ESPPreferenceObject make_preference(uint32_t type) {
+    return this->make_preference_(type, sizeof(T), false);
+  }
+
+ protected:
+  ESPPreferenceObject make_preference_(uint32_t type, size_t size, bool in_flash);
+};
+
+extern ESPPreferences *global_preferences;
+
+}  // namespace esphome
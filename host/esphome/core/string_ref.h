@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstring>
+#include <string>
+
+namespace esphome {
+
+/*
+ * Non-owning reference to a null terminated string
+ */
+class StringRef {
+ public:
+  StringRef() : str_("") {}
+  StringRef(const char *str) : str_(str != nullptr ? str : "") {}
+  StringRef(const std::string &str) : str_(str.c_str()) {}
+
+  const char *c_str() const { return this->str_; }
+  size_t size() const { return strlen(this->str_); }
+  bool empty() const { return *this->str_ == '\0'; }
+  std::string str() const { return this->str_; }
+
+  bool operator==(const char *other) const { return strcmp(this->str_, other) == 0; }
+  bool operator!=(const char *other) const { return !(*this == other); }
+  bool operator==(const std::string &other) const { return other == this->str_; }
+  bool operator!=(const std::string &other) const { return !(*this == other); }
+  bool operator==(const StringRef &other) const { return *this == other.str_; }
+  bool operator!=(const StringRef &other) const { return !(*this == other); }
+
+ protected:
+  const char *str_;
+};
+
+}  // namespace esphome
@@ -0,0 +1,257 @@
+#include "host.h"
+
+#include "esphome/components/climate/climate_mode.h"
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+#include "esphome/core/preferences.h"
+
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <thread>
+
+namespace esphome {
+
+namespace host {
+
+static bool real_clock = false;
+static uint64_t simulated_time_us = 0;
+static const auto CLOCK_START = std::chrono::steady_clock::now();
+
+void use_real_clock(bool real) { real_clock = real; }
+
+uint64_t time_us() {
+  if (!real_clock)
+    return simulated_time_us;
+
+  auto elapsed = std::chrono::steady_clock::now() - CLOCK_START;
+  return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+}
+
+void set_time_us(uint64_t time) { simulated_time_us = time; }
+
+void advance_time_us(uint64_t duration) { simulated_time_us += duration; }
+
+static int log_level = ESPHOME_LOG_LEVEL_DEBUG;
+static LogSink log_sink;
+
+void set_log_level(int level) { log_level = level; }
+
+void set_log_sink(LogSink sink) { log_sink = std::move(sink); }
+
+void reset_log_sink() { log_sink = nullptr; }
+
+struct StoredPreference {
+  std::vector<uint8_t> data;
+  bool in_flash;
+};
+
+static std::map<uint32_t, StoredPreference> preferences;
+
+void clear_preferences() { preferences.clear(); }
+
+bool preference_in_flash(uint32_t key) {
+  auto it = preferences.find(key);
+  return it != preferences.end() && it->second.in_flash;
+}
+
+static bool reboot = false;
+
+bool reboot_requested() { return reboot; }
+
+void clear_reboot_request() { reboot = false; }
+
+}  // namespace host
+
+/*
+ * HAL, 32 bit times wrap around like on the ESP
+ */
+
+uint32_t millis() { return (uint32_t) (host::time_us() / 1000); }
+
+uint32_t micros() { return (uint32_t) host::time_us(); }
+
+void delay(uint32_t ms) { delayMicroseconds(ms * 1000); }
+
+void delayMicroseconds(uint32_t us) {
+  if (host::real_clock)
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+  else
+    host::advance_time_us(us);
+}
+
+/*
+ * Logging
+ */
+
+void esp_log_printf_(int level, const char *tag, int /*line*/, const char *format, ...) {
+  if (level > host::log_level)
+    return;
+
+  char message[512];
+  va_list args;
+  va_start(args, format);
+  vsnprintf(message, sizeof(message), format, args);
+  va_end(args);
+
+  if (host::log_sink) {
+    host::log_sink(level, tag, message);
+    return;
+  }
+
+  static const char LETTERS[] = "NEWICDVV";
+  fprintf(stderr, "[%c][%s]: %s\n", LETTERS[level & 7], tag, message);
+}
+
+/*
+ * Helpers
+ */
+
+static const char BASE64_CHARS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+std::string base64_encode(const uint8_t *buf, size_t buf_len) {
+  std::string encoded;
+
+  for (size_t i = 0; i < buf_len; i += 3) {
+    uint32_t block = buf[i] << 16;
+    if (i + 1 < buf_len)
+      block |= buf[i + 1] << 8;
+    if (i + 2 < buf_len)
+      block |= buf[i + 2];
+
+    encoded += BASE64_CHARS[(block >> 18) & 0x3F];
+    encoded += BASE64_CHARS[(block >> 12) & 0x3F];
+    encoded += i + 1 < buf_len ? BASE64_CHARS[(block >> 6) & 0x3F] : '=';
+    encoded += i + 2 < buf_len ? BASE64_CHARS[block & 0x3F] : '=';
+  }
+
+  return encoded;
+}
+
+std::string base64_encode(const std::vector<uint8_t> &buf) { return base64_encode(buf.data(), buf.size()); }
+
+std::vector<uint8_t> base64_decode(const std::string &encoded) {
+  std::vector<uint8_t> decoded;
+  uint32_t block = 0;
+  int bits = 0;
+
+  for (char c : encoded) {
+    const char *pos = c != '\0' ? strchr(BASE64_CHARS, c) : nullptr;
+    if (pos == nullptr)
+      break;  // Padding or end of the encoded text
+
+    block = (block << 6) | (pos - BASE64_CHARS);
+    bits += 6;
+
+    if (bits >= 8) {
+      bits -= 8;
+      decoded.push_back((block >> bits) & 0xFF);
+    }
+  }
+
+  return decoded;
+}
+
+// Same as ESPHome: one allocation for the dump, plus the suffix with the length
+std::string format_hex_pretty(const uint8_t *data, size_t length) {
+  static const char *const HEX_CHARS = "0123456789ABCDEF";
+
+  if (length == 0)
+    return "";
+
+  std::string text(3 * length - 1, '.');
+
+  for (size_t i = 0; i < length; i++) {
+    text[3 * i] = HEX_CHARS[data[i] >> 4];
+    text[3 * i + 1] = HEX_CHARS[data[i] & 0x0F];
+  }
+
+  if (length > 4)
+    return text + " (" + std::to_string(length) + ")";
+
+  return text;
+}
+
+std::string format_hex_pretty(const std::vector<uint8_t> &data) { return format_hex_pretty(data.data(), data.size()); }
+
+uint32_t fnv1_hash(const std::string &str) {
+  uint32_t hash = 2166136261UL;
+  for (char c : str) {
+    hash *= 16777619UL;
+    hash ^= (uint8_t) c;
+  }
+  return hash;
+}
+
+/*
+ * Application and preferences
+ */
+
+Application App;
+
+void Application::safe_reboot() { host::reboot = true; }
+
+static ESPPreferences host_preferences;
+ESPPreferences *global_preferences = &host_preferences;
+
+ESPPreferenceObject ESPPreferences::make_preference_(uint32_t type, size_t size, bool in_flash) {
+  host::preferences[type].in_flash = in_flash;
+  return ESPPreferenceObject(type, size);
+}
+
+bool ESPPreferenceObject::save_(const void *data, size_t size) {
+  if (size != this->size_)
+    return false;
+
+  const uint8_t *bytes = static_cast<const uint8_t *>(data);
+  host::preferences[this->key_].data.assign(bytes, bytes + size);
+  return true;
+}
+
+bool ESPPreferenceObject::load_(void *data, size_t size) {
+  auto it = host::preferences.find(this->key_);
+  if (it == host::preferences.end() || it->second.data.size() != size)
+    return false;
+
+  memcpy(data, it->second.data.data(), size);
+  return true;
+}
+
+namespace climate {
+
+const char *climate_mode_to_string(ClimateMode mode) {
+  static const char *const NAMES[] = {"OFF", "HEAT_COOL", "COOL", "HEAT", "FAN_ONLY", "DRY", "AUTO"};
+  return mode <= CLIMATE_MODE_AUTO ? NAMES[mode] : "UNKNOWN";
+}
+
+const char *climate_action_to_string(ClimateAction action) {
+  switch (action) {
+    case CLIMATE_ACTION_OFF:
+      return "OFF";
+    case CLIMATE_ACTION_COOLING:
+      return "COOLING";
+    case CLIMATE_ACTION_HEATING:
+      return "HEATING";
+    case CLIMATE_ACTION_IDLE:
+      return "IDLE";
+    case CLIMATE_ACTION_DRYING:
+      return "DRYING";
+    case CLIMATE_ACTION_FAN:
+      return "FAN";
+    default:
+      return "UNKNOWN";
+  }
+}
+
+const char *climate_swing_mode_to_string(ClimateSwingMode swing_mode) {
+  static const char *const NAMES[] = {"OFF", "BOTH", "VERTICAL", "HORIZONTAL"};
+  return swing_mode <= CLIMATE_SWING_HORIZONTAL ? NAMES[swing_mode] : "UNKNOWN";
+}
+
+}  // namespace climate
+
+}  // namespace esphome
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+// Controls of the host implementation of the ESPHome API in esphome/, used by the host tools and tests to drive the
+// component without an ESP. Everything here is process global, like the ESPHome runtime it stands in for.
+
+namespace esphome {
+namespace host {
+
+/*
+ * Clock behind millis() and micros()
+ *
+ * The simulated clock only moves when told to, so tests and replays run as fast as the CPU allows. The real clock
+ * follows the monotonic system clock, delay() then actually sleeps.
+ */
+void use_real_clock(bool real);
+uint64_t time_us();
+void set_time_us(uint64_t time);
+void advance_time_us(uint64_t duration);
+inline void advance_time_ms(uint32_t duration) { advance_time_us(uint64_t(duration) * 1000); }
+
+/*
+ * Log output, messages above the level are dropped. The sink gets the level, the tag and the formatted message.
+ */
+using LogSink = std::function<void(int level, const char *tag, const char *message)>;
+void set_log_level(int level);
+void set_log_sink(LogSink sink);  // Default writes "[D][tag]: message" lines to stderr
+void reset_log_sink();
+
+/*
+ * Preferences are kept in memory for the lifetime of the process
+ */
+void clear_preferences();
+bool preference_in_flash(uint32_t key);  // Returns true if the preference with key was created with in_flash
+
+// Set by App.safe_reboot(), a host program decides itself what a reboot means
+bool reboot_requested();
+void clear_reboot_request();
+
+}  // namespace host
+}  // namespace esphome
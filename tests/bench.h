@@ -0,0 +1,67 @@
+#pragma once
+
+/*
+ * Minimal harness for the host benchmarks: wall time and heap allocations per operation
+ *
+ * Include in exactly one translation unit per benchmark, it replaces the global operator new to count allocations.
+ * The iteration count can be lowered with the first argument, ctest runs every benchmark once that way as a smoke
+ * test.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace bench {
+
+inline size_t allocations = 0;
+
+// Keeps the compiler from optimizing a result away
+template<typename T> inline void keep(T const &value) { asm volatile("" : : "r,m"(value) : "memory"); }
+
+inline long iterations(int argc, char **argv, long default_iterations) {
+  return argc > 1 ? std::atol(argv[1]) : default_iterations;
+}
+
+/*
+ * Runs operation iterations times in a few rounds after a short warm up and prints the time and allocations per run
+ * of the fastest round, the others were disturbed by something else
+ */
+template<typename Operation> void measure(const char *name, long iterations, Operation operation) {
+  static const int ROUNDS = 5;
+
+  for (long i = 0; i < iterations / 100; i++)
+    operation();
+
+  double best = 0;
+  size_t allocations_before = allocations;
+
+  for (int round = 0; round < ROUNDS; round++) {
+    auto start = std::chrono::steady_clock::now();
+
+    for (long i = 0; i < iterations; i++)
+      operation();
+
+    double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    if (round == 0 || elapsed < best)
+      best = elapsed;
+  }
+
+  printf("%-44s %10.1f ns %8.2f allocations\n", name, best / iterations,
+         (double) (allocations - allocations_before) / iterations / ROUNDS);
+}
+
+}  // namespace bench
+
+void *operator new(size_t size) {
+  bench::allocations++;
+
+  if (void *pointer = std::malloc(size))
+    return pointer;
+
+  throw std::bad_alloc();
+}
+
+void operator delete(void *pointer) noexcept { std::free(pointer); }
+void operator delete(void *pointer, size_t /*size*/) noexcept { std::free(pointer); }
@@ -0,0 +1,15 @@
+# Runs COMMAND with ARGS and compares its output with the EXPECTED file
+#
+#   cmake -DCOMMAND=<program> -DARGS=<arguments> -DEXPECTED=<file> -P compare_output.cmake
+
+separate_arguments(ARGS)
+execute_process(COMMAND ${COMMAND} ${ARGS} OUTPUT_VARIABLE output RESULT_VARIABLE result)
+
+if(NOT result EQUAL 0)
+  message(FATAL_ERROR "${COMMAND} failed (${result})")
+endif()
+
+file(READ ${EXPECTED} expected)
+if(NOT output STREQUAL expected)
+  message(FATAL_ERROR "Output differs from ${EXPECTED}:\n${output}")
+endif()
@@ -0,0 +1,40 @@
+#!/bin/sh
+# Runs panasonic_acd against pty_ac_simulator in real time: the first state is polled, a command changes the AC and
+# the state reported by the AC afterwards confirms it
+#
+#   daemon_test.sh <panasonic_acd> <pty_ac_simulator> cnt|wlan
+
+daemon=$1
+simulator=$2
+protocol=$3
+dir=$(mktemp -d)
+
+"$simulator" "$protocol" > "$dir/pty" 2> "$dir/simulator.log" &
+simulator_pid=$!
+trap 'kill $simulator_pid 2> /dev/null; rm -rf "$dir"' EXIT
+
+while [ ! -s "$dir/pty" ]; do sleep 0.1; done
+
+# The CN-CNT AC is polled every 5 s, the CN-WLAN handshake ends 10 s after the sync packet
+if [ "$protocol" = cnt ]; then
+  commands="mode heat|temperature 24"
+  command_at=6
+  quit_at=12
+  expected="mode=HEAT target=24.0"
+else
+  commands="mode cool|temperature 24"
+  command_at=14
+  quit_at=16
+  expected="mode=COOL target=24.0 .* action=COOLING"
+fi
+
+(sleep $command_at; echo "$commands" | tr '|' '\n'; sleep $((quit_at - command_at)); echo quit) |
+  "$daemon" "$protocol" "$(head -n 1 "$dir/pty")" > "$dir/daemon.log" 2>&1 || exit 1
+
+kill $simulator_pid
+wait $simulator_pid
+
+cat "$dir/daemon.log" "$dir/simulator.log"
+# A poll follows the command, its answer would have reverted the state if the command was lost
+[ "$(sed -n 's/ frames received.*//p' "$dir/simulator.log")" -ge 3 ] || exit 1
+grep climate: "$dir/daemon.log" | tail -n 1 | grep -q "$expected" || exit 1
@@ -0,0 +1,61 @@
+/*
+ * Host benchmark of the dispatch from the select and switch entities to the drivers
+ *
+ * Built by the host build in CMakeLists.txt. Toggles the nanoeX switch and changes the vertical swing select of both
+ * drivers, which runs the entity callback and the on_*_change() hook of the driver. The hooks only schedule a command,
+ * the command itself is never sent because the loop does not run.
+ *
+ *   dispatch_bench [iterations]
+ */
+
+#include "bench.h"
+
+#include "esppac_cnt.h"
+#include "esppac_wlan.h"
+#include "panasonic_ac_select.h"
+#include "panasonic_ac_switch.h"
+
+#include "host.h"
+
+using namespace esphome;
+using namespace esphome::panasonic_ac;
+
+template<typename Driver> static void run(const char *protocol, long iterations) {
+  uart::FifoUART uart;
+  PanasonicACSelect vertical_swing;
+  PanasonicACSwitch nanoex;
+
+  vertical_swing.traits.set_options({"swing", "auto", "up", "up_center", "center", "down_center", "down"});
+
+  Driver driver;
+  driver.set_uart_parent(&uart);
+  driver.set_vertical_swing_select(&vertical_swing);
+  driver.set_nanoex_switch(&nanoex);
+  driver.setup();
+
+  char name[64];
+  bool state = false;
+  size_t index = 0;
+
+  snprintf(name, sizeof(name), "%s, nanoeX switch change", protocol);
+  bench::measure(name, iterations, [&] {
+    state = !state;
+    nanoex.publish_state(state);
+  });
+
+  snprintf(name, sizeof(name), "%s, vertical swing select change", protocol);
+  bench::measure(name, iterations, [&] {
+    index = (index + 1) % vertical_swing.size();
+    vertical_swing.publish_state(index);
+  });
+}
+
+int main(int argc, char **argv) {
+  long iterations = bench::iterations(argc, argv, 1000000);
+
+  host::set_log_level(ESPHOME_LOG_LEVEL_NONE);
+
+  run<CNT::PanasonicACCNT>("CN-CNT", iterations);
+  run<WLAN::PanasonicACWLAN>("CN-WLAN", iterations);
+  return 0;
+}
@@ -0,0 +1,167 @@
+/*
+ * Host stress test and benchmark of the SPSC frame queue used by the RX task
+ *
+ * A std::thread producer plays the RX task, the main thread plays the loop. Every frame carries its sequence number
+ * in the timestamp and a pattern derived from it in the data, so lost, duplicated, reordered or torn frames are
+ * detected by the consumer.
+ *
+ * Built by the host build in CMakeLists.txt and run by ctest, or on its own with a frame count:
+ *   ./frame_queue_test [frames]
+ */
+
+#include "esppac_frame_queue.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+using esphome::panasonic_ac::FrameQueue;
+using esphome::panasonic_ac::ReceivedFrame;
+
+static const size_t QUEUE_CAPACITY = 4;  // Same as RX_QUEUE_SIZE
+static const size_t FRAME_SIZE = 128;    // Same as BUFFER_SIZE
+
+using Queue = FrameQueue<QUEUE_CAPACITY, FRAME_SIZE>;
+
+static int failures = 0;
+
+#define CHECK(condition) \
+  do { \
+    if (!(condition)) { \
+      fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+      failures++; \
+    } \
+  } while (0)
+
+static uint8_t frame_length(uint32_t sequence) { return 1 + sequence % FRAME_SIZE; }
+
+static uint8_t frame_byte(uint32_t sequence, size_t index) { return (uint8_t) (sequence * 31 + index); }
+
+static void fill_frame(ReceivedFrame<FRAME_SIZE> *frame, uint32_t sequence) {
+  frame->timestamp = sequence;
+  frame->length = frame_length(sequence);
+
+  for (size_t i = 0; i < frame->length; i++)
+    frame->data[i] = frame_byte(sequence, i);
+}
+
+static bool frame_matches(const ReceivedFrame<FRAME_SIZE> *frame, uint32_t sequence) {
+  if (frame->timestamp != sequence || frame->length != frame_length(sequence))
+    return false;
+
+  for (size_t i = 0; i < frame->length; i++) {
+    if (frame->data[i] != frame_byte(sequence, i))
+      return false;
+  }
+
+  return true;
+}
+
+/*
+ * Single threaded: empty and full detection, FIFO order and index wrap around
+ */
+static void test_single_thread() {
+  static Queue queue;
+
+  CHECK(queue.empty());
+  CHECK(queue.peek() == nullptr);
+
+  uint32_t written = 0;
+  uint32_t read = 0;
+
+  // Enough rounds to wrap the 8 bit indices several times
+  for (int round = 0; round < 1000; round++) {
+    while (ReceivedFrame<FRAME_SIZE> *frame = queue.acquire()) {
+      fill_frame(frame, written++);
+      queue.commit();
+    }
+
+    CHECK(written - read == QUEUE_CAPACITY);  // Full after exactly Capacity frames
+    CHECK(!queue.empty());
+
+    // Drain half, the freed slots must be reused in order
+    for (size_t i = 0; i < QUEUE_CAPACITY / 2; i++) {
+      const ReceivedFrame<FRAME_SIZE> *frame = queue.peek();
+      CHECK(frame != nullptr && frame_matches(frame, read));
+      queue.pop();
+      read++;
+    }
+  }
+
+  while (const ReceivedFrame<FRAME_SIZE> *frame = queue.peek()) {
+    CHECK(frame_matches(frame, read));
+    queue.pop();
+    read++;
+  }
+
+  CHECK(read == written);
+  CHECK(queue.empty());
+}
+
+/*
+ * Producer and consumer on separate threads, the producer retries while the queue is full
+ */
+static void test_threads(uint32_t frames) {
+  static Queue queue;
+  uint32_t full = 0;
+
+  auto start = std::chrono::steady_clock::now();
+
+  std::thread producer([frames, &full]() {
+    for (uint32_t sequence = 0; sequence < frames; sequence++) {
+      ReceivedFrame<FRAME_SIZE> *frame;
+
+      while ((frame = queue.acquire()) == nullptr) {
+        full++;
+        std::this_thread::yield();
+      }
+
+      fill_frame(frame, sequence);
+      queue.commit();
+    }
+  });
+
+  uint32_t received = 0;
+  uint32_t corrupt = 0;
+
+  while (received < frames) {
+    const ReceivedFrame<FRAME_SIZE> *frame = queue.peek();
+
+    if (frame == nullptr) {
+      std::this_thread::yield();
+      continue;
+    }
+
+    if (!frame_matches(frame, received))
+      corrupt++;
+
+    queue.pop();
+    received++;
+  }
+
+  producer.join();
+
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  CHECK(corrupt == 0);
+  CHECK(queue.empty());
+
+  printf("%u frames in %.3f s (%.0f frames/s), %u corrupt, producer found the queue full %u times\n",
+         (unsigned) frames, seconds, frames / seconds, (unsigned) corrupt, (unsigned) full);
+}
+
+int main(int argc, char **argv) {
+  uint32_t frames = argc > 1 ? strtoul(argv[1], nullptr, 10) : 1000000;
+
+  test_single_thread();
+  test_threads(frames);
+
+  if (failures > 0) {
+    fprintf(stderr, "%d checks failed\n", failures);
+    return 1;
+  }
+
+  printf("All checks passed\n");
+  return 0;
+}
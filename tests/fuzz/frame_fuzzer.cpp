@@ -0,0 +1,108 @@
+/*
+ * Fuzz target for the frame codecs and the receive paths of both drivers
+ *
+ * Every input is checked by CNT::check_frame() and WLAN::check_frame() and then received by a fresh driver of each
+ * protocol, once from the AC and once from the official adapter in passive mode. Before a driver receives the input
+ * its header, length and checksum are fixed up so the fuzzer reaches the decoders instead of stopping at the checksum.
+ * The CN-WLAN driver is put into the ready state first, so reports walk through decode_fields().
+ *
+ * Built with -fsanitize=fuzzer when the compiler is Clang, e.g.
+ *
+ *   CXX=clang++ cmake -S . -B build-fuzz -DSANITIZE=address,undefined && cmake --build build-fuzz --target frame_fuzzer
+ *   build-fuzz/frame_fuzzer tests/fuzz/corpus
+ *
+ * Otherwise standalone_main.cpp runs the seed corpus in tests/fuzz/corpus and random mutations of it under ctest. The
+ * corpus holds the CN-WLAN frames of the captures in protocol/logic_analyzer, written by tools/dsl_uart.py corpus, and
+ * the CN-CNT frames documented in esppac_conformance_cnt.h with a few variations.
+ */
+
+#include "esppac_cnt.h"
+#include "esppac_wlan.h"
+
+#include "host.h"
+
+#include <type_traits>
+#include <vector>
+
+using namespace esphome;
+using namespace esphome::panasonic_ac;
+
+namespace {
+
+struct WLANDriver : WLAN::PanasonicACWLAN {
+  void set_ready() { this->state_ = WLAN::ACState::Ready; }
+};
+
+// Fix up length and checksum of a CN-CNT frame, the header is left alone so both frame types are reached
+std::vector<uint8_t> seal_cnt(const uint8_t *data, size_t size) {
+  std::vector<uint8_t> frame(data, data + size);
+
+  if (frame.size() >= CNT::FRAME_OVERHEAD && frame.size() <= BUFFER_SIZE) {
+    frame[1] = frame.size() - CNT::FRAME_OVERHEAD;
+    frame.back() = checksum_for(frame.data(), frame.size() - 1);
+  }
+
+  return frame;
+}
+
+// Fix up header and checksum of a CN-WLAN frame, the counter is left alone so the counter checks are reached
+std::vector<uint8_t> seal_wlan(const uint8_t *data, size_t size) {
+  std::vector<uint8_t> frame(data, data + size);
+
+  if (frame.size() >= WLAN::MIN_FRAME_SIZE && frame.size() <= BUFFER_SIZE)
+    WLAN::seal_frame(frame.data(), frame.size(), frame[1]);
+
+  return frame;
+}
+
+// Receive frame on the given side and run the loop until the frame is complete
+template<typename Driver> void receive(Driver &driver, uart::FifoUART &uart, const std::vector<uint8_t> &frame) {
+  uart.receive(frame);
+  driver.loop();
+
+  host::advance_time_ms(READ_TIMEOUT + 1);
+  driver.loop();
+}
+
+template<typename Driver> void run(const std::vector<uint8_t> &frame, bool passive) {
+  uart::FifoUART ac_side, controller_side;
+
+  Driver driver;
+  driver.set_uart_parent(&ac_side);
+  if (passive) {
+    driver.set_passive(true);
+    driver.set_controller_uart(&controller_side);
+  }
+  driver.setup();
+
+  if constexpr (std::is_same<Driver, WLANDriver>::value)
+    driver.set_ready();
+
+  receive(driver, passive ? controller_side : ac_side, frame);
+}
+
+}  // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+  static bool initialized = false;
+  if (!initialized) {
+    host::set_log_level(ESPHOME_LOG_LEVEL_NONE);
+    initialized = true;
+  }
+
+  FrameView frame(data, size);
+  volatile FrameError error;  // Keeps the checks from being optimized away
+  error = CNT::check_frame(frame);
+  error = WLAN::check_frame(frame);
+  (void) error;
+
+  std::vector<uint8_t> cnt = seal_cnt(data, size);
+  std::vector<uint8_t> wlan = seal_wlan(data, size);
+
+  for (bool passive : {false, true}) {
+    run<CNT::PanasonicACCNT>(cnt, passive);
+    run<WLANDriver>(wlan, passive);
+  }
+
+  return 0;
+}
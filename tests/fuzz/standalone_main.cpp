@@ -0,0 +1,111 @@
+/*
+ * Runs a fuzz target without libFuzzer, for compilers that do not support -fsanitize=fuzzer
+ *
+ *   frame_fuzzer_standalone [-runs=N] [-seed=N] <file or directory>...
+ *
+ * Every file is passed to LLVMFuzzerTestOneInput() once, then N random mutations of them (default 0). The mutations
+ * are repeatable for a seed, so a failing run can be reproduced. Unlike libFuzzer there is no coverage feedback, the
+ * sanitizers do the checking.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <sys/stat.h>
+#include <vector>
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+static const size_t MAX_SIZE = 256;
+
+static void add_path(const std::string &path, std::vector<std::vector<uint8_t>> &inputs) {
+  struct stat info;
+  if (stat(path.c_str(), &info) != 0) {
+    fprintf(stderr, "Cannot open %s\n", path.c_str());
+    exit(2);
+  }
+
+  if (S_ISDIR(info.st_mode)) {
+    DIR *dir = opendir(path.c_str());
+    while (dirent *entry = readdir(dir)) {
+      if (entry->d_name[0] != '.')
+        add_path(path + "/" + entry->d_name, inputs);
+    }
+    closedir(dir);
+    return;
+  }
+
+  std::ifstream file(path, std::ios::binary);
+  inputs.emplace_back(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+static std::vector<uint8_t> mutate(std::vector<uint8_t> input, std::mt19937 &random) {
+  int mutations = 1 + random() % 4;
+
+  for (int i = 0; i < mutations; i++) {
+    size_t pos = input.empty() ? 0 : random() % input.size();
+
+    switch (random() % 5) {
+      case 0:  // Flip a bit
+        if (!input.empty())
+          input[pos] ^= 1 << (random() % 8);
+        break;
+      case 1:  // Replace a byte
+        if (!input.empty())
+          input[pos] = random();
+        break;
+      case 2:  // Insert a byte
+        if (input.size() < MAX_SIZE)
+          input.insert(input.begin() + pos, (uint8_t) random());
+        break;
+      case 3:  // Erase a byte
+        if (!input.empty())
+          input.erase(input.begin() + pos);
+        break;
+      default:  // Cut the input
+        input.resize(pos);
+        break;
+    }
+  }
+
+  return input;
+}
+
+int main(int argc, char **argv) {
+  long runs = 0;
+  unsigned seed = 1;
+  std::vector<std::vector<uint8_t>> inputs;
+
+  for (int i = 1; i < argc; i++) {
+    if (strncmp(argv[i], "-runs=", 6) == 0)
+      runs = atol(argv[i] + 6);
+    else if (strncmp(argv[i], "-seed=", 6) == 0)
+      seed = strtoul(argv[i] + 6, nullptr, 10);
+    else
+      add_path(argv[i], inputs);
+  }
+
+  for (const auto &input : inputs)
+    LLVMFuzzerTestOneInput(input.data(), input.size());
+
+  printf("Ran %zu inputs\n", inputs.size());
+
+  if (inputs.empty() || runs == 0)
+    return 0;
+
+  std::mt19937 random(seed);
+
+  for (long run = 0; run < runs; run++) {
+    std::vector<uint8_t> input = mutate(inputs[random() % inputs.size()], random);
+    LLVMFuzzerTestOneInput(input.data(), input.size());
+  }
+
+  printf("Ran %ld mutations with seed %u\n", runs, seed);
+  return 0;
+}
@@ -0,0 +1,68 @@
+/*
+ * Host benchmark of the per-frame cost of packet tracing
+ *
+ * Built twice by the host build in CMakeLists.txt: log_packet_bench_verbose against the component with verbose
+ * logging, log_packet_bench_quiet against the component with logging compiled out. Both compare log_packet() with the
+ * previous implementation, which copied the frame and formatted it with format_hex_pretty().
+ *
+ *   log_packet_bench_verbose [iterations]
+ */
+
+#include "bench.h"
+
+#include "esppac_cnt.h"
+
+#include "host.h"
+
+#include <vector>
+
+using namespace esphome;
+using namespace esphome::panasonic_ac;
+
+static const char *const TAG = "panasonic_ac";
+
+struct Tracer : CNT::PanasonicACCNT {
+  using PanasonicAC::log_packet;
+};
+
+// The implementation before packet tracing was compiled out, called out of line like it was from esppac.cpp
+__attribute__((noinline)) static void copying_log_packet(std::vector<uint8_t> data, bool outgoing = false) {
+  if (outgoing) {
+    ESP_LOGV(TAG, "TX: %s", format_hex_pretty(data).c_str());
+  } else {
+    ESP_LOGV(TAG, "RX: %s", format_hex_pretty(data).c_str());
+  }
+}
+
+int main(int argc, char **argv) {
+  long iterations = bench::iterations(argc, argv, 1000000);
+
+  // Formatting is measured, writing the log is not
+  size_t logged = 0;
+  host::set_log_level(ESPHOME_LOG_LEVEL_VERBOSE);
+  host::set_log_sink([&logged](int, const char *, const char *) { logged++; });
+
+  Tracer tracer;
+  std::vector<uint8_t> query_response(125);  // Longest CN-WLAN frame
+  std::vector<uint8_t> poll_response(35);    // CN-CNT poll response
+
+  for (size_t i = 0; i < query_response.size(); i++)
+    query_response[i] = i * 7;
+  for (size_t i = 0; i < poll_response.size(); i++)
+    poll_response[i] = i * 13;
+
+  printf("Log level %d\n", ESPHOME_LOG_LEVEL);
+
+  for (auto *frame : {&poll_response, &query_response}) {
+    char name[64];
+
+    snprintf(name, sizeof(name), "log_packet, %zu byte frame", frame->size());
+    bench::measure(name, iterations, [&] { tracer.log_packet(*frame); });
+
+    snprintf(name, sizeof(name), "copy and format_hex_pretty, %zu byte frame", frame->size());
+    bench::measure(name, iterations, [&] { copying_log_packet(*frame); });
+  }
+
+  bench::keep(logged);
+  return 0;
+}
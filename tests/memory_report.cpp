@@ -0,0 +1,225 @@
+/*
+ * Heap used by the drivers, measured on the host over a simulated hour
+ *
+ * Built by the host build in CMakeLists.txt and run by ctest. Every allocation made while a driver runs, in setup(),
+ * loop() and perform(), is counted with its requested size, the allocations of the simulation and the simulated AC are
+ * not. For every configuration the report lists the size of the object, the buffers reported by get_heap_size(), the
+ * heap kept after setup, the heap kept after an hour of polls, a user call and a few reports, the peak above that and
+ * the number of allocations during the hour. Three CN-CNT units share one simulation to show that the cost per unit
+ * adds up linearly. The test fails if the buffers are not all counted by get_heap_size() or the heap kept grows
+ * during the hour.
+ *
+ * The heap kept after setup includes the climate traits, which live in the ESPHome API and differ in size between
+ * the host stand-in and ESPHome.
+ */
+
+#include "sim/simulated_ac.h"
+#include "sim/simulation.h"
+
+#include "esppac_cnt.h"
+#include "esppac_wlan.h"
+
+#include "host.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <new>
+#include <vector>
+
+using namespace esphome;
+using namespace esphome::panasonic_ac;
+
+static int failures = 0;
+
+#define CHECK(condition) \
+  do { \
+    if (!(condition)) { \
+      fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+      failures++; \
+    } \
+  } while (0)
+
+/*
+ * Heap of the code run while counting is set, blocks carry their size and whether they were counted in a header, so
+ * freeing blocks of other code, like the receive buffer of the UART, does not lower live
+ */
+namespace heap {
+static bool counting = false;
+static long long live = 0;
+static long long peak = 0;
+static size_t allocations = 0;
+
+struct alignas(alignof(std::max_align_t)) Header {
+  size_t size;
+  bool counted;
+};
+
+// Counts the driver only, the frames it writes are taken over by the simulated AC
+struct Paused {
+  bool previous = counting;
+  Paused() { counting = false; }
+  ~Paused() { counting = previous; }
+};
+
+struct Counted {
+  Counted() { counting = true; }
+  ~Counted() { counting = false; }
+};
+}  // namespace heap
+
+void *operator new(size_t size) {
+  auto *header = static_cast<heap::Header *>(malloc(sizeof(heap::Header) + size));
+  if (header == nullptr)
+    throw std::bad_alloc();
+
+  header->size = size;
+  header->counted = heap::counting;
+  if (heap::counting) {
+    heap::live += size;
+    heap::peak = std::max(heap::peak, heap::live);
+    heap::allocations++;
+  }
+  return header + 1;
+}
+
+void *operator new[](size_t size) { return operator new(size); }
+
+void operator delete(void *pointer) noexcept {
+  if (pointer == nullptr)
+    return;
+
+  auto *header = static_cast<heap::Header *>(pointer) - 1;
+  if (header->counted)
+    heap::live -= header->size;
+  free(header);
+}
+
+void operator delete[](void *pointer) noexcept { operator delete(pointer); }
+void operator delete(void *pointer, size_t) noexcept { operator delete(pointer); }
+void operator delete[](void *pointer, size_t) noexcept { operator delete(pointer); }
+
+static const uint64_t HOUR_MS = 60 * 60 * 1000;
+
+class PausedUART : public uart::FifoUART {
+ public:
+  void write_array(const uint8_t *data, size_t length) override {
+    heap::Paused paused;
+    FifoUART::write_array(data, length);
+  }
+};
+
+template<typename Driver> class Unit : public Driver {
+ public:
+  using Driver::get_heap_size;
+  using Driver::get_instance_size;
+
+  void loop() override {
+    heap::Counted counted;
+    Driver::loop();
+  }
+};
+
+struct Measurement {
+  size_t instance = 0;
+  size_t buffers = 0;
+  long long after_setup = 0;
+  long long after_hour = 0;
+  long long peak = 0;
+  size_t allocations = 0;
+};
+
+static void print(const char *name, const Measurement &m) {
+  printf("%-28s %6zu %8zu %8lld %8lld %8lld %8zu\n", name, m.instance, m.buffers, m.after_setup, m.after_hour,
+         m.peak - m.after_hour, m.allocations);
+}
+
+template<typename Driver, typename AC, typename Configure>
+static Measurement measure(size_t units, Configure configure, std::function<void(AC &, Unit<Driver> &)> user) {
+  host::set_time_us(1000000);
+  host::set_log_level(ESPHOME_LOG_LEVEL_NONE);
+  heap::live = heap::peak = 0;
+  heap::allocations = 0;
+
+  sim::Simulation simulation;
+  std::unique_ptr<PausedUART[]> uarts(new PausedUART[units]);
+  std::vector<std::unique_ptr<AC>> acs;
+  std::vector<std::unique_ptr<Unit<Driver>>> drivers;
+  Measurement m;
+
+  for (size_t i = 0; i < units; i++) {
+    acs.emplace_back(new AC(simulation, uarts[i]));
+    drivers.emplace_back(new Unit<Driver>());
+    drivers[i]->set_uart_parent(&uarts[i]);
+    configure(*drivers[i]);
+
+    heap::Counted counted;
+    drivers[i]->setup();
+  }
+
+  m.after_setup = heap::live;
+  heap::peak = heap::live;
+  heap::allocations = 0;
+
+  for (size_t i = 0; i < units; i++) {
+    simulation.add_component(drivers[i].get());
+    simulation.after_ms(30 * 60 * 1000, [&, i] {
+      heap::Counted counted;
+      user(*acs[i], *drivers[i]);
+    });
+  }
+  simulation.run_for_ms(HOUR_MS);
+
+  m.after_hour = heap::live;
+  m.peak = heap::peak;
+  m.allocations = heap::allocations;
+
+  for (const auto &driver : drivers) {
+    m.instance += driver->get_instance_size();
+    m.buffers += driver->get_heap_size();
+  }
+
+  host::set_log_level(ESPHOME_LOG_LEVEL_WARN);
+  return m;
+}
+
+int main() {
+  printf("%-28s %6s %8s %8s %8s %8s %8s\n", "", "object", "buffers", "setup", "1 h", "peak", "allocs");
+
+  auto cnt_user = [](sim::CNTAC &, Unit<CNT::PanasonicACCNT> &driver) {
+    driver.make_call().set_mode(climate::CLIMATE_MODE_HEAT).set_target_temperature(23).perform();
+  };
+  auto wlan_user = [](sim::WLANAC &ac, Unit<WLAN::PanasonicACWLAN> &driver) {
+    ac.power_on();
+    driver.make_call().set_mode(climate::CLIMATE_MODE_COOL).set_target_temperature(23).perform();
+  };
+
+  Measurement cnt = measure<CNT::PanasonicACCNT, sim::CNTAC>(1, [](PanasonicAC &) {}, cnt_user);
+  print("CN-CNT", cnt);
+  Measurement cnt_recorder = measure<CNT::PanasonicACCNT, sim::CNTAC>(
+      1, [](PanasonicAC &driver) { driver.set_flight_recorder_size(16); }, cnt_user);
+  print("CN-CNT, flight recorder 16", cnt_recorder);
+  Measurement cnt_three = measure<CNT::PanasonicACCNT, sim::CNTAC>(3, [](PanasonicAC &) {}, cnt_user);
+  print("CN-CNT, 3 units", cnt_three);
+  Measurement wlan = measure<WLAN::PanasonicACWLAN, sim::WLANAC>(1, [](PanasonicAC &) {}, wlan_user);
+  print("CN-WLAN", wlan);
+
+  for (const Measurement *m : {&cnt, &cnt_recorder, &cnt_three, &wlan}) {
+    CHECK(m->after_setup >= (long long) m->buffers);  // Every buffer is allocated by setup()
+    CHECK(m->after_hour <= m->after_setup);           // Nothing is kept for good after setup
+  }
+
+  // The recorder is the only difference
+  size_t recorder = 16 * sizeof(RecordedPacket);
+  CHECK(cnt_recorder.buffers == cnt.buffers + recorder);
+  CHECK(cnt_recorder.after_setup == cnt.after_setup + (long long) recorder);
+
+  CHECK(cnt_three.instance == 3 * cnt.instance);
+  CHECK(cnt_three.buffers == 3 * cnt.buffers);
+  CHECK(cnt_three.after_setup == 3 * cnt.after_setup);
+
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,121 @@
+/*
+ * Host benchmark of the CN-CNT poll response cache over a day of polls
+ *
+ * Built by the host build in CMakeLists.txt. Feeds a synthetic day of poll responses (one every POLL_INTERVAL) to the
+ * CN-CNT driver with all entities attached, once decoding every response like before the cache and once with the
+ * cache. There is no recording of a full day, the day follows a typical pattern instead: the AC runs in the morning
+ * and in the evening, the inside temperature changes every 20 minutes, the outside temperature every hour and the
+ * power consumption every minute while running.
+ *
+ *   poll_cache_bench [iterations]
+ */
+
+#include "bench.h"
+
+#include "esppac_cnt.h"
+#include "panasonic_ac_select.h"
+#include "panasonic_ac_switch.h"
+
+#include "host.h"
+
+#include <vector>
+
+using namespace esphome;
+using namespace esphome::panasonic_ac;
+
+static const size_t POLLS_PER_DAY = 24 * 60 * 60 * 1000 / CNT::POLL_INTERVAL;
+
+struct Driver : CNT::PanasonicACCNT {
+  void receive(const std::vector<uint8_t> &frame, bool cache) {
+    if (!cache)
+      this->poll_cache_valid_ = false;
+
+    this->rx_buffer_ = frame;
+    this->handle_packet();
+  }
+};
+
+static std::vector<uint8_t> poll_response(size_t poll) {
+  // Documented response, see esppac_conformance_cnt.h
+  std::vector<uint8_t> frame{0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x19, 0x40, 0x00, 0x40, 0x00, 0x00,
+                             0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF,
+                             0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x00};
+
+  size_t minute = poll * CNT::POLL_INTERVAL / 60000;
+  size_t hour = minute / 60;
+  bool running = (hour >= 7 && hour < 9) || (hour >= 17 && hour < 23);
+
+  frame[2] = running ? 0x34 : 0x30;
+  frame[3] = hour >= 20 ? 0x2C : 0x2B;      // Target temperature raised in the evening
+  frame[5] = hour >= 21 ? 0xA0 : 0x50;      // Fan speed set to automatic later
+  frame[18] = 22 + (minute / 20) % 3;       // Inside temperature
+  frame[19] = 15 + hour % 8;                // Outside temperature
+  frame[28] = running ? minute % 251 : 0;   // Power consumption, low byte
+  frame[29] = running ? 0x02 : 0x00;        // High byte
+  frame[30] = 0;                            // Offset
+
+  uint8_t checksum = 0;
+  for (size_t i = 0; i < frame.size() - 1; i++)
+    checksum -= frame[i];
+  frame.back() = checksum;
+
+  return frame;
+}
+
+int main(int argc, char **argv) {
+  long iterations = bench::iterations(argc, argv, 10 * POLLS_PER_DAY);
+
+  host::set_log_level(ESPHOME_LOG_LEVEL_NONE);
+
+  uart::FifoUART uart;
+  PanasonicACSelect vertical_swing, horizontal_swing;
+  PanasonicACSwitch nanoex, eco, econavi, mild_dry;
+  sensor::Sensor outside_temperature, power_consumption;
+  binary_sensor::BinarySensor defrost;
+
+  vertical_swing.traits.set_options({"swing", "auto", "up", "up_center", "center", "down_center", "down"});
+  horizontal_swing.traits.set_options({"auto", "left", "left_center", "center", "right_center", "right"});
+
+  Driver driver;
+  driver.set_uart_parent(&uart);
+  driver.set_vertical_swing_select(&vertical_swing);
+  driver.set_horizontal_swing_select(&horizontal_swing);
+  driver.set_nanoex_switch(&nanoex);
+  driver.set_eco_switch(&eco);
+  driver.set_econavi_switch(&econavi);
+  driver.set_mild_dry_switch(&mild_dry);
+  driver.set_outside_temperature_sensor(&outside_temperature);
+  driver.set_current_power_consumption_sensor(&power_consumption);
+  driver.set_defrost_sensor(&defrost);
+  driver.setup();
+
+  size_t published = 0;
+  driver.add_on_state_callback([&published](climate::Climate &) { published++; });
+
+  std::vector<std::vector<uint8_t>> day;
+  size_t changed = 0;
+
+  for (size_t poll = 0; poll < POLLS_PER_DAY; poll++) {
+    day.push_back(poll_response(poll));
+    changed += poll > 0 && day[poll] != day[poll - 1];
+  }
+
+  printf("%zu polls per day, %zu of them differ from the previous one\n", day.size(), changed);
+
+  for (bool cache : {false, true}) {
+    size_t poll = 0;
+    published = 0;
+
+    for (const auto &frame : day)
+      driver.receive(frame, cache);
+
+    printf("%s: %zu climate publishes per day\n", cache ? "With cache" : "Without cache", published);
+
+    bench::measure(cache ? "Poll response, with cache" : "Poll response, decoding every response", iterations, [&] {
+      driver.receive(day[poll], cache);
+      poll = (poll + 1) % day.size();
+    });
+  }
+
+  return 0;
+}
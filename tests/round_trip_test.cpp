@@ -0,0 +1,643 @@
+/*
+ * Host test that what both drivers encode for a climate call or an entity change decodes back to the same state
+ *
+ * Built by the host build in CMakeLists.txt and run by ctest. Each driver runs against its simulated AC of tests/sim.
+ * A passive driver of the same protocol listens to the frames of both directions, with read only entities like in an
+ * installation next to an official adapter. The state it shows was decoded from the line, never published
+ * optimistically by control(). The test keeps a model of the state the AC must end up in and checks the driver and the
+ * listener against it after every case:
+ *
+ * - every mode, every target temperature with and without an offset, every fan mode, swing mode, preset, swing
+ *   position and switch state on its own, checking the raw values the AC stores where the mapping is not one to one:
+ *   CN-WLAN turns the power off for mode OFF and centers the axes that stop swinging
+ * - random calls of several fields at once and random entity changes, from a fixed seed or the one given
+ *
+ * Set commands must not add unknown report fields to the listener and no driver may log an unknown packet. All cases
+ * of both protocols must run at MIN_CASES_PER_SECOND or more, a cheap gate for the cost of encoding and decoding.
+ *
+ *   round_trip_test [-v] [seed]
+ *
+ * -v prints the log of the drivers at DEBUG level.
+ */
+
+#include "sim/simulated_ac.h"
+#include "sim/simulation.h"
+
+#include "esppac_cnt.h"
+#include "esppac_wlan.h"
+#include "panasonic_ac_select.h"
+#include "panasonic_ac_switch.h"
+
+#include "host.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace esphome;
+using namespace esphome::panasonic_ac;
+
+static int failures = 0;
+static std::string current;  // Case being checked, printed with failures
+static size_t unknown_packets = 0;  // Packets the drivers did not recognise, none are expected
+
+#define CHECK(condition) \
+  do { \
+    if (!(condition)) { \
+      fprintf(stderr, "%s:%d: %s: check failed: %s\n", __FILE__, __LINE__, current.c_str(), #condition); \
+      failures++; \
+    } \
+  } while (0)
+
+static const uint64_t START_US = 1000000;
+static const size_t RANDOM_CASES = 1000;           // Per protocol
+static const size_t QUERY_EVERY = 50;              // CN-WLAN random cases between two checks of a query response
+static const double MIN_CASES_PER_SECOND = 10000;  // About 350000 measured on a PC, 55000 with sanitizers
+static const int8_t OFFSETS[]{0, 2, -3};           // Current temperature offsets the temperatures are tried with
+
+static const char *const FAN_MODES[]{"Automatic", "1", "2", "3", "4", "5"};
+static const char *const PRESETS[]{"Normal", "Powerful", "Quiet"};
+static const climate::ClimateMode MODES[]{climate::CLIMATE_MODE_OFF,  climate::CLIMATE_MODE_HEAT_COOL,
+                                          climate::CLIMATE_MODE_COOL, climate::CLIMATE_MODE_HEAT,
+                                          climate::CLIMATE_MODE_DRY,  climate::CLIMATE_MODE_FAN_ONLY};
+static const climate::ClimateSwingMode SWING_MODES[]{climate::CLIMATE_SWING_OFF, climate::CLIMATE_SWING_BOTH,
+                                                     climate::CLIMATE_SWING_VERTICAL,
+                                                     climate::CLIMATE_SWING_HORIZONTAL};
+
+// Options of the selects, as set by climate.py
+static const std::vector<std::string> VERTICAL_OPTIONS{"swing",  "auto",        "up",  "up_center",
+                                                       "center", "down_center", "down"};
+static const std::vector<std::string> HORIZONTAL_OPTIONS{"auto",   "left",         "left_center",
+                                                         "center", "right_center", "right"};
+
+/*
+ * State shown by a driver and its entities, also the model of the expected state
+ */
+struct State {
+  climate::ClimateMode mode;
+  float target_temperature;
+  std::string fan_mode;
+  std::string preset;
+  climate::ClimateSwingMode swing_mode;
+  std::string vertical_swing;
+  std::string horizontal_swing;
+  bool nanoex;
+  bool eco;
+  bool econavi;
+  bool mild_dry;
+};
+
+/*
+ * Driver with the entities it publishes to
+ */
+template<typename Driver> struct Unit {
+  Driver driver;
+  PanasonicACSelect vertical_swing, horizontal_swing;
+  PanasonicACSwitch nanoex, eco, econavi, mild_dry;
+  text_sensor::TextSensor unknown_fields;
+
+  Unit() {
+    this->vertical_swing.traits.set_options(VERTICAL_OPTIONS);
+    this->horizontal_swing.traits.set_options(HORIZONTAL_OPTIONS);
+    this->driver.set_vertical_swing_select(&this->vertical_swing);
+    this->driver.set_horizontal_swing_select(&this->horizontal_swing);
+    this->driver.set_nanoex_switch(&this->nanoex);
+  }
+
+  // Like climate.py does in passive mode
+  void set_read_only() {
+    for (PanasonicACSelect *select : {&this->vertical_swing, &this->horizontal_swing})
+      select->set_read_only(true);
+    for (PanasonicACSwitch *entity : {&this->nanoex, &this->eco, &this->econavi, &this->mild_dry})
+      entity->set_read_only(true);
+  }
+
+  State state() const {
+    return {this->driver.mode,
+            this->driver.target_temperature,
+            this->driver.get_custom_fan_mode().str(),
+            this->driver.get_custom_preset().str(),
+            this->driver.swing_mode,
+            this->vertical_swing.current_option().str(),
+            this->horizontal_swing.current_option().str(),
+            this->nanoex.state,
+            this->eco.state,
+            this->econavi.state,
+            this->mild_dry.state};
+  }
+};
+
+static void check_state(const char *who, const State &shown, const State &expected) {
+  std::string outer = current;
+  current += std::string(", ") + who;
+
+  CHECK(shown.mode == expected.mode);
+  CHECK(shown.target_temperature == expected.target_temperature);
+  CHECK(shown.fan_mode == expected.fan_mode);
+  CHECK(shown.preset == expected.preset);
+  CHECK(shown.swing_mode == expected.swing_mode);
+  CHECK(shown.vertical_swing == expected.vertical_swing);
+  CHECK(shown.horizontal_swing == expected.horizontal_swing);
+  CHECK(shown.nanoex == expected.nanoex);
+  CHECK(shown.eco == expected.eco);
+  CHECK(shown.econavi == expected.econavi);
+  CHECK(shown.mild_dry == expected.mild_dry);
+
+  current = outer;
+}
+
+// Target temperature shown for a requested one, on the TEMPERATURE_STEP grid of the AC around the offset
+static float shown_temperature(float requested, int8_t offset) {
+  return std::round((requested - offset) / TEMPERATURE_STEP) * TEMPERATURE_STEP + offset;
+}
+
+/*
+ * A change of one or more fields, applied to the driver and to the model of the expected state
+ */
+struct Change {
+  optional<climate::ClimateMode> mode;
+  optional<float> target_temperature;
+  optional<std::string> fan_mode;
+  optional<climate::ClimateSwingMode> swing_mode;
+  optional<std::string> preset;
+  optional<std::string> vertical_swing;    // Entity changes are made one at a time, after the call
+  optional<std::string> horizontal_swing;
+  optional<bool> nanoex, eco, econavi, mild_dry;
+
+  std::string describe() const {
+    std::string text;
+    auto add = [&text](const std::string &part) { text += (text.empty() ? "" : " ") + part; };
+
+    if (this->mode)
+      add(std::string("mode=") + climate::climate_mode_to_string(*this->mode));
+    if (this->target_temperature)
+      add("target=" + std::to_string(*this->target_temperature));
+    if (this->fan_mode)
+      add("fan=" + *this->fan_mode);
+    if (this->swing_mode)
+      add(std::string("swing=") + climate::climate_swing_mode_to_string(*this->swing_mode));
+    if (this->preset)
+      add("preset=" + *this->preset);
+    if (this->vertical_swing)
+      add("vertical=" + *this->vertical_swing);
+    if (this->horizontal_swing)
+      add("horizontal=" + *this->horizontal_swing);
+    if (this->nanoex)
+      add(std::string("nanoex=") + (*this->nanoex ? "on" : "off"));
+    if (this->eco)
+      add(std::string("eco=") + (*this->eco ? "on" : "off"));
+    if (this->econavi)
+      add(std::string("econavi=") + (*this->econavi ? "on" : "off"));
+    if (this->mild_dry)
+      add(std::string("mild_dry=") + (*this->mild_dry ? "on" : "off"));
+
+    return text;
+  }
+
+  bool has_call() const {
+    return this->mode || this->target_temperature || this->fan_mode || this->swing_mode || this->preset;
+  }
+};
+
+/*
+ * Protocol specific parts: the simulated AC, settling times, the effects of swing changes and the raw values
+ */
+struct CNTProtocol {
+  using Driver = CNT::PanasonicACCNT;
+  using AC = sim::CNTAC;
+
+  static constexpr const char *NAME = "CN-CNT";
+  static constexpr bool HAS_FLAGS = true;  // Eco, econavi and mild dry
+  static const uint64_t SETTLE_MS = CNT::CMD_INTERVAL + CNT::POLL_INTERVAL + 1000;  // Sent, then confirmed by a poll
+
+  static std::vector<std::string> vertical_positions() { return VERTICAL_OPTIONS; }
+  static std::vector<std::string> horizontal_positions() { return HORIZONTAL_OPTIONS; }
+
+  static void start(AC &) {}
+  static bool is_ready(const AC &) { return true; }
+
+  static void attach(Unit<Driver> &unit) {
+    unit.driver.set_eco_switch(&unit.eco);
+    unit.driver.set_econavi_switch(&unit.econavi);
+    unit.driver.set_mild_dry_switch(&unit.mild_dry);
+  }
+
+  // Both axes are set, the swing mode follows from the axes in auto
+  static void apply_swing_mode(State &state, climate::ClimateSwingMode swing) {
+    bool vertical = swing == climate::CLIMATE_SWING_BOTH || swing == climate::CLIMATE_SWING_VERTICAL;
+    bool horizontal = swing == climate::CLIMATE_SWING_BOTH || swing == climate::CLIMATE_SWING_HORIZONTAL;
+    state.vertical_swing = vertical ? "auto" : "center";
+    state.horizontal_swing = horizontal ? "auto" : "center";
+  }
+
+  static void apply_position(State &state) {
+    bool vertical = state.vertical_swing == "auto", horizontal = state.horizontal_swing == "auto";
+    state.swing_mode = vertical && horizontal ? climate::CLIMATE_SWING_BOTH
+                       : vertical             ? climate::CLIMATE_SWING_VERTICAL
+                       : horizontal           ? climate::CLIMATE_SWING_HORIZONTAL
+                                              : climate::CLIMATE_SWING_OFF;
+  }
+
+  static uint8_t raw_mode(const AC &ac) { return ac.state.mode(); }
+
+  static void check_raw(const AC &ac, const Change &change, uint8_t mode_before, int8_t offset) {
+    if (change.mode) {
+      CHECK(ac.state.power() == (*change.mode != climate::CLIMATE_MODE_OFF));
+      if (*change.mode == climate::CLIMATE_MODE_OFF)
+        CHECK(ac.state.mode() == mode_before);  // Only the power is turned off
+    }
+
+    if (change.target_temperature)
+      CHECK(ac.state.target_temperature() == std::lround((*change.target_temperature - offset) / TEMPERATURE_STEP));
+
+    // Unless the same case moved an axis afterwards
+    if (change.swing_mode && *change.swing_mode == climate::CLIMATE_SWING_OFF) {
+      if (!change.vertical_swing)
+        CHECK(ac.state.vertical_swing() == CNT::VERTICAL_SWING_CENTER);
+      if (!change.horizontal_swing)
+        CHECK(ac.state.horizontal_swing() == CNT::HORIZONTAL_SWING_CENTER);
+    }
+  }
+};
+
+struct WLANProtocol {
+  using Driver = WLAN::PanasonicACWLAN;
+  using AC = sim::WLANAC;
+
+  static constexpr const char *NAME = "CN-WLAN";
+  static constexpr bool HAS_FLAGS = false;
+  static const uint64_t SETTLE_MS = 1000;  // Sent right away, the AC reports after 100 ms
+
+  // Swing and auto are no positions of CN-WLAN
+  static std::vector<std::string> vertical_positions() { return {"up", "up_center", "center", "down_center", "down"}; }
+  static std::vector<std::string> horizontal_positions() {
+    return {"left", "left_center", "center", "right_center", "right"};
+  }
+
+  static void start(AC &ac) { ac.power_on(); }
+  static bool is_ready(const AC &ac) { return ac.ready; }  // Handshake done
+
+  static void attach(Unit<Driver> &unit) { unit.driver.set_unknown_fields_sensor(&unit.unknown_fields); }
+
+  // The swing mode is a field of its own, the axes that stop swinging are centered
+  static void apply_swing_mode(State &state, climate::ClimateSwingMode swing) {
+    if (swing == climate::CLIMATE_SWING_OFF || swing == climate::CLIMATE_SWING_HORIZONTAL)
+      state.vertical_swing = "center";
+    if (swing == climate::CLIMATE_SWING_OFF || swing == climate::CLIMATE_SWING_VERTICAL)
+      state.horizontal_swing = "center";
+  }
+
+  static void apply_position(State &) {}
+
+  static uint8_t raw_mode(const AC &ac) { return ac.get(WLAN::KEY_MODE); }
+
+  static void check_raw(const AC &ac, const Change &change, uint8_t mode_before, int8_t offset) {
+    if (change.mode) {
+      bool off = *change.mode == climate::CLIMATE_MODE_OFF;
+      CHECK(ac.get(WLAN::KEY_POWER) == (off ? WLAN::POWER_OFF : WLAN::POWER_ON));
+      if (off)
+        CHECK(ac.get(WLAN::KEY_MODE) == mode_before);  // Only the power is turned off
+    }
+
+    if (change.target_temperature) {
+      long raw = std::lround((*change.target_temperature - offset) / TEMPERATURE_STEP);
+      CHECK(ac.get(WLAN::KEY_TARGET_TEMPERATURE) == raw);
+    }
+
+    if (change.swing_mode && *change.swing_mode == climate::CLIMATE_SWING_OFF) {
+      if (!change.vertical_swing)
+        CHECK(ac.get(WLAN::KEY_VERTICAL_SWING) == WLAN::SWING_CENTER);
+      if (!change.horizontal_swing)
+        CHECK(ac.get(WLAN::KEY_HORIZONTAL_SWING) == WLAN::SWING_CENTER);
+    }
+  }
+};
+
+/*
+ * A driver and a passive listener of one protocol on a simulated AC
+ */
+template<typename Protocol> class Bench {
+ public:
+  explicit Bench(int8_t offset = 0) : ac_(simulation_, uart_), offset_(offset) {
+    host::set_time_us(START_US);
+
+    this->ac_.set_taps(&this->ac_tap_, &this->controller_tap_);
+    Protocol::start(this->ac_);
+
+    this->active_.driver.set_uart_parent(&this->uart_);
+    this->active_.driver.set_current_temperature_offset(offset);
+    Protocol::attach(this->active_);
+    this->active_.driver.setup();
+    this->simulation_.add_component(&this->active_.driver);
+
+    this->listener_.driver.set_uart_parent(&this->ac_tap_);
+    this->listener_.driver.set_current_temperature_offset(offset);
+    this->listener_.driver.set_passive(true);
+    this->listener_.driver.set_controller_uart(&this->controller_tap_);
+    this->listener_.set_read_only();
+    Protocol::attach(this->listener_);
+    this->listener_.driver.setup();
+    this->simulation_.add_component(&this->listener_.driver);
+
+    // Every driver set up so far staggers the start of the next one by INSTANCE_STAGGER
+    for (int i = 0; i < 600 && !this->is_started(); i++)
+      this->simulation_.run_for_ms(1000);
+    this->expected_ = this->active_.state();
+
+    current = std::string(Protocol::NAME) + " startup";
+    check_state("listener", this->listener_.state(), this->expected_);
+  }
+
+  // Makes the change, waits until the AC confirmed it and checks the AC, the driver and the listener
+  void run(const Change &change) {
+    current = std::string(Protocol::NAME) + " " + change.describe();
+    uint8_t mode_before = Protocol::raw_mode(this->ac_);
+
+    this->apply(change);
+    this->simulation_.run_for_ms(Protocol::SETTLE_MS);
+    this->cases_++;
+
+    Protocol::check_raw(this->ac_, change, mode_before, this->offset_);
+    check_state("driver", this->active_.state(), this->expected_);
+    check_state("listener", this->listener_.state(), this->expected_);
+    CHECK(this->listener_.unknown_fields.state == this->active_.unknown_fields.state);  // Set commands add none
+  }
+
+  // Waits for the next poll, so the listener decodes the complete state from a query or poll response
+  void check_poll(uint64_t wait_ms) {
+    this->simulation_.run_for_ms(wait_ms);
+    current = std::string(Protocol::NAME) + " after a poll";
+    check_state("listener", this->listener_.state(), this->expected_);
+  }
+
+  // Changes of the entities of the listener are dropped, it keeps showing the state of the line
+  void check_read_only() {
+    current = std::string(Protocol::NAME) + " read only listener";
+    bool up = this->listener_.vertical_swing.current_option() == "up";
+
+    this->listener_.vertical_swing.make_call().set_option(up ? "down" : "up").perform();
+    this->listener_.nanoex.toggle();
+    check_state("listener", this->listener_.state(), this->expected_);
+  }
+
+  size_t cases() const { return this->cases_; }
+
+ protected:
+  bool is_started() {
+    return Protocol::is_ready(this->ac_) && this->active_.driver.has_custom_fan_mode() &&
+           this->listener_.driver.has_custom_fan_mode();
+  }
+
+  void apply(const Change &change) {
+    State &expected = this->expected_;
+
+    if (change.has_call()) {
+      auto call = this->active_.driver.make_call();
+
+      if (change.mode) {
+        call.set_mode(*change.mode);
+        expected.mode = *change.mode;
+      }
+      if (change.target_temperature) {
+        call.set_target_temperature(*change.target_temperature);
+        expected.target_temperature = shown_temperature(*change.target_temperature, this->offset_);
+      }
+      if (change.fan_mode) {
+        call.set_fan_mode(*change.fan_mode);
+        expected.fan_mode = *change.fan_mode;
+        expected.preset = "Normal";  // A fan mode ends the preset
+      }
+      if (change.swing_mode) {
+        call.set_swing_mode(*change.swing_mode);
+        expected.swing_mode = *change.swing_mode;
+        Protocol::apply_swing_mode(expected, *change.swing_mode);
+      }
+      if (change.preset) {
+        call.set_preset(*change.preset);
+        expected.preset = *change.preset;
+      }
+
+      call.perform();
+    }
+
+    if (change.vertical_swing) {
+      this->active_.vertical_swing.make_call().set_option(*change.vertical_swing).perform();
+      expected.vertical_swing = *change.vertical_swing;
+      Protocol::apply_position(expected);
+    }
+    if (change.horizontal_swing) {
+      this->active_.horizontal_swing.make_call().set_option(*change.horizontal_swing).perform();
+      expected.horizontal_swing = *change.horizontal_swing;
+      Protocol::apply_position(expected);
+    }
+
+    set_switch(this->active_.nanoex, change.nanoex, expected.nanoex);
+    set_switch(this->active_.eco, change.eco, expected.eco);
+    set_switch(this->active_.econavi, change.econavi, expected.econavi);
+    set_switch(this->active_.mild_dry, change.mild_dry, expected.mild_dry);
+  }
+
+  static void set_switch(switch_::Switch &entity, const optional<bool> &state, bool &expected) {
+    if (!state)
+      return;
+
+    if (*state)
+      entity.turn_on();
+    else
+      entity.turn_off();
+    expected = *state;
+  }
+
+  sim::Simulation simulation_;
+  uart::FifoUART uart_, ac_tap_, controller_tap_;
+  typename Protocol::AC ac_;
+  Unit<typename Protocol::Driver> active_, listener_;
+  int8_t offset_;
+  State expected_;
+  size_t cases_ = 0;
+};
+
+/*
+ * Every value of every field on its own
+ */
+template<typename Protocol> static void test_each_value(Bench<Protocol> &bench) {
+  for (climate::ClimateMode mode : MODES) {
+    Change change;
+    change.mode = mode;
+    bench.run(change);
+  }
+
+  for (float temperature = MIN_TEMPERATURE; temperature <= MAX_TEMPERATURE; temperature += TEMPERATURE_STEP) {
+    Change change;
+    change.target_temperature = temperature;
+    bench.run(change);
+  }
+
+  Change between;  // Rounded to the nearest step
+  between.target_temperature = 22.3f;
+  bench.run(between);
+
+  for (const char *fan_mode : FAN_MODES) {
+    Change change;
+    change.fan_mode = fan_mode;
+    bench.run(change);
+  }
+
+  for (climate::ClimateSwingMode swing : SWING_MODES) {
+    Change change;
+    change.swing_mode = swing;
+    bench.run(change);
+  }
+
+  for (const char *preset : PRESETS) {
+    Change change;
+    change.preset = preset;
+    bench.run(change);
+  }
+
+  for (const std::string &position : Protocol::vertical_positions()) {
+    Change change;
+    change.vertical_swing = position;
+    bench.run(change);
+  }
+
+  for (const std::string &position : Protocol::horizontal_positions()) {
+    Change change;
+    change.horizontal_swing = position;
+    bench.run(change);
+  }
+
+  for (bool state : {true, false}) {
+    Change change;
+    change.nanoex = state;
+    bench.run(change);
+
+    if (!Protocol::HAS_FLAGS)
+      continue;
+
+    for (optional<bool> Change::*flag : {&Change::eco, &Change::econavi, &Change::mild_dry}) {
+      Change flag_change;
+      flag_change.*flag = state;
+      bench.run(flag_change);
+    }
+  }
+}
+
+/*
+ * Random calls of any combination of fields, each followed by at most one entity change
+ */
+template<typename Protocol> static void test_random(Bench<Protocol> &bench, uint32_t seed, uint64_t poll_wait_ms) {
+  std::mt19937 random(seed);
+  auto chance = [&random](int percent) { return (int) (random() % 100) < percent; };
+  auto pick = [&random](size_t count) { return random() % count; };
+
+  std::vector<std::string> vertical = Protocol::vertical_positions();
+  std::vector<std::string> horizontal = Protocol::horizontal_positions();
+  size_t steps = (MAX_TEMPERATURE - MIN_TEMPERATURE) / TEMPERATURE_STEP;
+
+  for (size_t i = 0; i < RANDOM_CASES; i++) {
+    Change change;
+
+    if (chance(40))
+      change.mode = MODES[pick(sizeof(MODES) / sizeof(MODES[0]))];
+    if (chance(40))
+      change.target_temperature = MIN_TEMPERATURE + pick(steps + 1) * TEMPERATURE_STEP;
+    if (chance(30))
+      change.fan_mode = FAN_MODES[pick(sizeof(FAN_MODES) / sizeof(FAN_MODES[0]))];
+    if (chance(30))
+      change.swing_mode = SWING_MODES[pick(sizeof(SWING_MODES) / sizeof(SWING_MODES[0]))];
+    if (chance(30))
+      change.preset = PRESETS[pick(sizeof(PRESETS) / sizeof(PRESETS[0]))];
+
+    switch (pick(Protocol::HAS_FLAGS ? 8 : 5)) {
+      case 0:
+        change.vertical_swing = vertical[pick(vertical.size())];
+        break;
+      case 1:
+        change.horizontal_swing = horizontal[pick(horizontal.size())];
+        break;
+      case 2:
+        change.nanoex = chance(50);
+        break;
+      case 5:
+        change.eco = chance(50);
+        break;
+      case 6:
+        change.econavi = chance(50);
+        break;
+      case 7:
+        change.mild_dry = chance(50);
+        break;
+      default:
+        break;  // Only the call
+    }
+
+    bench.run(change);
+
+    if (poll_wait_ms > 0 && (i + 1) % QUERY_EVERY == 0)
+      bench.check_poll(poll_wait_ms);
+  }
+}
+
+template<typename Protocol> static size_t test_protocol(uint32_t seed, uint64_t poll_wait_ms) {
+  size_t cases = 0;
+
+  for (int8_t offset : OFFSETS) {
+    Bench<Protocol> bench(offset);
+
+    bench.check_read_only();
+    test_each_value(bench);
+    bench.check_poll(poll_wait_ms);
+    test_random(bench, seed + offset, poll_wait_ms);
+
+    cases += bench.cases();
+  }
+
+  return cases;
+}
+
+int main(int argc, char **argv) {
+  bool verbose = false;
+  uint32_t seed = 1;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-v") == 0)
+      verbose = true;
+    else
+      seed = strtoul(argv[i], nullptr, 0);
+  }
+
+  host::set_log_level(verbose ? ESPHOME_LOG_LEVEL_DEBUG : ESPHOME_LOG_LEVEL_WARN);
+  host::set_log_sink([verbose](int level, const char *tag, const char *message) {
+    static const char LETTERS[] = "NEWICDVV";
+
+    if (strncmp(message, "Received unknown packet", 23) == 0)
+      unknown_packets++;
+    if (verbose)
+      fprintf(stderr, "[%c][%s]: %s\n", LETTERS[level & 7], tag, message);
+  });
+
+  auto start = std::chrono::steady_clock::now();
+
+  // CN-CNT polls every POLL_INTERVAL, CN-WLAN once per ping of the AC
+  size_t cases = test_protocol<CNTProtocol>(seed, CNT::POLL_INTERVAL);
+  cases += test_protocol<WLANProtocol>(seed, sim::WLANAC::PING_INTERVAL + 1000);
+
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  double rate = cases / seconds;
+
+  printf("%zu round trips with seed %u in %.2f s, %.0f per second\n", cases, seed, seconds, rate);
+
+  current = "log";
+  CHECK(unknown_packets == 0);
+
+  current = "throughput";
+  CHECK(rate >= MIN_CASES_PER_SECOND);
+
+  return failures == 0 ? 0 : 1;
+}
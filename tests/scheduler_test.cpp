@@ -0,0 +1,104 @@
+/*
+ * Host test of the protocol timer table, driven by a simulated clock
+ *
+ * Built by the host build in CMakeLists.txt and run by ctest
+ */
+
+#include "esppac_scheduler.h"
+
+#include <cstdio>
+
+using esphome::panasonic_ac::TimerTable;
+
+enum class Timer : uint8_t { Read, Poll, Init, InitFail, Count };
+
+using Timers = TimerTable<Timer, (size_t) Timer::Count>;
+
+static int failures = 0;
+
+#define CHECK(condition) \
+  do { \
+    if (!(condition)) { \
+      fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+      failures++; \
+    } \
+  } while (0)
+
+static void test_due() {
+  Timers timers;
+
+  CHECK(!timers.any_due(0));
+  CHECK(timers.time_to_next(0) == UINT32_MAX);
+
+  timers.arm(Timer::Poll, 1000, 1000, 5000);
+  timers.arm(Timer::Read, 1000, 1000, 20);
+
+  CHECK(timers.time_to_next(1000) == 20);
+  CHECK(!timers.is_due(Timer::Read, 1019));
+  CHECK(timers.is_due(Timer::Read, 1020));
+  CHECK(!timers.is_due(Timer::Poll, 1020));
+
+  timers.cancel(Timer::Read);
+
+  CHECK(!timers.is_armed(Timer::Read));
+  CHECK(timers.time_to_next(1020) == 4980);  // Next deadline moves on to the poll
+  CHECK(!timers.any_due(5999));
+  CHECK(timers.any_due(6000));
+}
+
+static void test_past_start() {
+  Timers timers;
+
+  // A start long ago is due right away instead of wrapping into the future
+  timers.arm(Timer::Poll, 100000, 1000, 5000);
+
+  CHECK(timers.is_due(Timer::Poll, 100000));
+  CHECK(timers.time_to_next(100000) == 0);
+}
+
+static void test_future_start() {
+  // Several ACs on one ESP start from staggered init times that lie in the future
+  for (uint32_t index = 0; index < 3; index++) {
+    Timers timers;
+    uint32_t now = 500;
+    uint32_t init_time = now + index * 1000;
+
+    timers.arm(Timer::InitFail, now, init_time, 30000);
+    timers.arm(Timer::Init, now, init_time, 10000);
+    timers.arm(Timer::Poll, now, init_time, 5000);
+
+    CHECK(!timers.is_due(Timer::InitFail, now));
+    CHECK(!timers.is_due(Timer::Init, now));
+    CHECK(!timers.is_due(Timer::Poll, now));
+    CHECK(timers.time_to_next(now) == 5000 + index * 1000);
+    CHECK(timers.is_due(Timer::Poll, init_time + 5000));
+    CHECK(!timers.is_due(Timer::InitFail, init_time + 29999));
+  }
+}
+
+static void test_wrap_around() {
+  Timers timers;
+  uint32_t now = UINT32_MAX - 1000;
+
+  timers.arm(Timer::Poll, now, now, 5000);  // Deadline lies behind the wrap around
+
+  CHECK(!timers.is_due(Timer::Poll, UINT32_MAX));
+  CHECK(!timers.is_due(Timer::Poll, 3998));
+  CHECK(timers.is_due(Timer::Poll, 3999));
+  CHECK(timers.time_to_next(UINT32_MAX) == 4000);
+}
+
+int main() {
+  test_due();
+  test_past_start();
+  test_future_start();
+  test_wrap_around();
+
+  if (failures > 0) {
+    fprintf(stderr, "%d checks failed\n", failures);
+    return 1;
+  }
+
+  printf("All checks passed\n");
+  return 0;
+}
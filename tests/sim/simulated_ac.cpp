@@ -0,0 +1,228 @@
+#include "simulated_ac.h"
+
+#include "esppac_codec.h"
+#include "esppac_conformance_cnt.h"
+
+#include <algorithm>
+
+namespace sim {
+
+using namespace esphome::panasonic_ac;
+
+SimulatedAC::SimulatedAC(Simulation &simulation, FifoUART &uart) : simulation_(simulation), uart_(uart) {
+  uart.set_write_callback([this](const uint8_t *data, size_t length) {
+    std::vector<uint8_t> frame(data, data + length);
+
+    this->simulation_.after_us(length * BYTE_TIME_US, [this, frame] {
+      if (!this->connected_)
+        return;
+
+      this->frames_received_++;
+      if (this->controller_tap_ != nullptr)
+        this->controller_tap_->receive(frame);
+      this->on_frame(frame);
+    });
+  });
+}
+
+void SimulatedAC::send(const std::vector<uint8_t> &frame, uint32_t delay) {
+  this->simulation_.after_us(delay * 1000ULL + frame.size() * BYTE_TIME_US, [this, frame] {
+    if (!this->connected_)
+      return;
+
+    this->frames_sent_++;
+    this->uart_.receive(frame);
+    if (this->ac_tap_ != nullptr)
+      this->ac_tap_->receive(frame);
+  });
+}
+
+/*
+ * CN-CNT
+ */
+
+CNTAC::CNTAC(Simulation &simulation, FifoUART &uart)
+    : SimulatedAC(simulation, uart), state(CNT::conformance::RESPONSE_STATE) {}
+
+std::vector<uint8_t> CNTAC::poll_response() const {
+  std::vector<uint8_t> frame(std::begin(CNT::conformance::QUERY_RESPONSE), std::end(CNT::conformance::QUERY_RESPONSE));
+
+  std::copy(this->state.raw, this->state.raw + CNT::STATE_SIZE, frame.begin() + CNT::QUERY_STATE);
+  frame[CNT::QUERY_CURRENT_TEMPERATURE] = this->inside_temperature;
+  frame[CNT::QUERY_OUTSIDE_TEMPERATURE] = this->outside_temperature;
+  frame[CNT::QUERY_POWER_CONSUMPTION] = this->power_consumption & 0xFF;
+  frame[CNT::QUERY_POWER_CONSUMPTION + 1] = this->power_consumption >> 8;
+  frame[CNT::QUERY_POWER_CONSUMPTION + 2] = 0;
+  frame.back() = checksum_for(frame.data(), frame.size() - 1);
+
+  return frame;
+}
+
+void CNTAC::on_frame(const std::vector<uint8_t> &frame) {
+  if (CNT::check_frame(FrameView(frame)) != FrameError::None)
+    return;
+
+  if (frame[0] == CNT::POLL_HEADER) {
+    this->polls++;
+    this->send(this->poll_response());
+  } else if (frame.size() >= CNT::QUERY_STATE + CNT::STATE_SIZE) {
+    this->commands++;
+    this->state = CNT::load_state(frame.data() + CNT::QUERY_STATE);
+  }
+}
+
+/*
+ * CN-WLAN
+ */
+
+// Query response captured in protocol/logic_analyzer/controller/on_off.dsl, the values are replaced by those of the AC
+static const uint8_t QUERY_RESPONSE[]{
+    0x5A, 0x26, 0x10, 0x89, 0x00, 0x76, 0x00, 0x01, 0x30, 0x01, 0x11, 0x00, 0x80, 0x01, 0x31, 0x00, 0xB0, 0x01,
+    0x42, 0x02, 0x31, 0x01, 0x30, 0x00, 0xA0, 0x01, 0x41, 0x00, 0xA1, 0x01, 0x42, 0x00, 0xA5, 0x01, 0x42, 0x00,
+    0xA4, 0x01, 0x42, 0x00, 0xB2, 0x01, 0x41, 0x02, 0x35, 0x01, 0x41, 0x02, 0x33, 0x01, 0x43, 0x02, 0x34, 0x01,
+    0x41, 0x02, 0x32, 0x01, 0x41, 0x00, 0xBB, 0x01, 0x16, 0x00, 0xBE, 0x01, 0x0F, 0x02, 0x20, 0x01, 0x42, 0x02,
+    0x21, 0x01, 0x41, 0x00, 0x86, 0x2E, 0x2A, 0x00, 0x00, 0x0B, 0x01, 0x01, 0x48, 0x30, 0x30, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F};
+
+static const uint8_t QUERY_PAIRS = 10;  // Index of the number of key value pairs
+static const uint8_t FIRST_PAIR = 12;   // Key of the first pair, its value follows 2 bytes later
+static const uint8_t KEY_INSIDE_TEMPERATURE = 0xBB;
+static const uint8_t KEY_OUTSIDE_TEMPERATURE = 0xBE;
+
+WLANAC::WLANAC(Simulation &simulation, FifoUART &uart) : SimulatedAC(simulation, uart) {
+  for (uint8_t i = 0; i < QUERY_RESPONSE[QUERY_PAIRS]; i++)
+    this->values[QUERY_RESPONSE[FIRST_PAIR + i * 4]] = QUERY_RESPONSE[FIRST_PAIR + i * 4 + 2];
+
+  this->values[KEY_INSIDE_TEMPERATURE] = 22;
+  this->values[KEY_OUTSIDE_TEMPERATURE] = 15;
+}
+
+std::vector<uint8_t> WLANAC::query_response(uint8_t counter) const {
+  std::vector<uint8_t> frame(std::begin(QUERY_RESPONSE), std::end(QUERY_RESPONSE));
+
+  for (uint8_t i = 0; i < frame[QUERY_PAIRS]; i++)
+    frame[FIRST_PAIR + i * 4 + 2] = this->values.at(frame[FIRST_PAIR + i * 4]);
+
+  WLAN::seal_frame(frame.data(), frame.size(), counter);
+  return frame;
+}
+
+void WLANAC::power_on() {
+  std::vector<uint8_t> sync(WLAN::MIN_FRAME_SIZE);
+  sync[0] = WLAN::SYNC_HEADER;
+  this->send(sync);
+}
+
+void WLANAC::change(const std::map<uint8_t, uint8_t> &values) {
+  for (const auto &value : values)
+    this->values[value.first] = value.second;
+
+  this->send_report(values);
+}
+
+void WLANAC::on_frame(const std::vector<uint8_t> &frame) {
+  if (WLAN::check_frame(FrameView(frame)) != FrameError::None || frame.size() < 6)
+    return;
+
+  uint8_t high = frame[2], low = frame[3];
+
+  if (low & 0x80) {  // Answer of the driver
+    if (high == 0x01 && low == 0x81) {
+      this->ping_answers++;
+    } else if (high == 0x10 && low == 0x8A && frame[1] == this->unacked_report_) {
+      this->report_acks++;
+      this->unacked_report_ = 0;
+    }
+    return;
+  }
+
+  if (high == 0x00 && low == 0x06)
+    return;  // First handshake packet, never answered
+
+  if (high == 0x10 && low == 0x09) {
+    this->polls++;
+    this->send(this->query_response(frame[1]));
+    return;
+  }
+
+  this->answer(frame);
+
+  if (high == 0x10 && low == 0x08) {
+    if (!this->ready) {  // Handshake 13, the AC sends its counter and then its version request
+      this->simulation_.after_ms(100, [this] { this->send_unsolicited(0x01, 0x09); });
+      this->simulation_.after_ms(200, [this] { this->send_unsolicited(0x00, 0x20); });
+      return;
+    }
+
+    this->set_commands++;
+
+    std::map<uint8_t, uint8_t> changed;
+    for (uint8_t i = 0; i < frame[QUERY_PAIRS] && FIRST_PAIR + i * 4 + 2u < frame.size(); i++)
+      changed[frame[FIRST_PAIR + i * 4]] = frame[FIRST_PAIR + i * 4 + 2];
+
+    this->simulation_.after_ms(100, [this, changed] { this->change(changed); });
+  } else if (high == 0x01 && low == 0x00 && frame[6] == 0x11 && !this->ready) {  // Handshake 16
+    this->ready = true;
+    this->simulation_.after_ms(PING_INTERVAL, [this] { this->ping(); });
+  }
+}
+
+void WLANAC::answer(const std::vector<uint8_t> &frame) {
+  std::vector<uint8_t> packet{WLAN::HEADER, 0, frame[2], (uint8_t) (frame[3] | 0x80), 0x00, 0x00, 0};
+  WLAN::seal_frame(packet.data(), packet.size(), frame[1]);
+  this->send(packet);
+}
+
+void WLANAC::send_unsolicited(uint8_t type_high, uint8_t type_low) {
+  std::vector<uint8_t> packet{WLAN::HEADER, 0, type_high, type_low, 0x00, 0x00, 0};
+  WLAN::seal_frame(packet.data(), packet.size(), this->counter);
+  this->counter = WLAN::next_counter(this->counter);
+  this->send(packet, 0);
+}
+
+void WLANAC::send_report(const std::map<uint8_t, uint8_t> &values) {
+  std::vector<uint8_t> report(FIRST_PAIR + values.size() * 4);
+  report[2] = 0x10;
+  report[3] = 0x0A;
+  report[5] = report.size() - 7;
+  report[QUERY_PAIRS] = values.size();
+
+  size_t index = FIRST_PAIR;
+  for (const auto &value : values) {
+    report[index] = value.first;
+    report[index + 1] = 0x01;
+    report[index + 2] = value.second;
+    index += 4;
+  }
+
+  WLAN::seal_frame(report.data(), report.size(), this->counter);
+  this->counter = WLAN::next_counter(this->counter);
+
+  this->reports++;
+  this->unacked_report_ = report[1];  // Only the latest report is resent
+  this->send(report, 0);
+  this->resend_report(report, REPORT_RESENDS);
+}
+
+void WLANAC::resend_report(std::vector<uint8_t> report, uint8_t resends) {
+  if (resends == 0)
+    return;
+
+  this->simulation_.after_ms(REPORT_RESEND_INTERVAL, [this, report, resends] {
+    if (this->unacked_report_ != report[1])
+      return;
+
+    this->send(report, 0);
+    this->resend_report(report, resends - 1);
+  });
+}
+
+void WLANAC::ping() {
+  this->pings++;
+  this->send_unsolicited(0x01, 0x01);  // Also while disconnected, the counter moves on
+
+  this->simulation_.after_ms(PING_INTERVAL, [this] { this->ping(); });
+}
+
+}  // namespace sim
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "simulation.h"
+
+#include "esppac_registers_wlan.h"
+#include "esppac_state_cnt.h"
+
+#include "esphome/components/uart/uart.h"
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace sim {
+
+using esphome::uart::FifoUART;
+
+static const uint32_t BYTE_TIME_US = 1146;  // 11 bits (8E1) at 9600 baud, both protocols
+static const uint32_t RESPONSE_DELAY = 40;  // Time the AC takes to answer a frame in ms
+
+/*
+ * AC on the other end of the UART of a driver
+ *
+ * Every write of the driver is one frame, it reaches the AC after its transmission time. Frames sent by the AC are
+ * received by the driver the same way. Cutting the link drops the frames of both directions, like a loose cable.
+ */
+class SimulatedAC {
+ public:
+  SimulatedAC(Simulation &simulation, FifoUART &uart);
+  virtual ~SimulatedAC() = default;
+
+  void set_connected(bool connected) { this->connected_ = connected; }
+  // Taps of a passive listener, they also receive every frame the AC sends and every frame the driver sends
+  void set_taps(FifoUART *ac_tap, FifoUART *controller_tap) {
+    this->ac_tap_ = ac_tap;
+    this->controller_tap_ = controller_tap;
+  }
+  bool is_connected() const { return this->connected_; }
+
+  size_t frames_received() const { return this->frames_received_; }
+  size_t frames_sent() const { return this->frames_sent_; }
+
+ protected:
+  virtual void on_frame(const std::vector<uint8_t> &frame) = 0;
+
+  // Sends frame after delay ms, it is received completely after its transmission time
+  void send(const std::vector<uint8_t> &frame, uint32_t delay = RESPONSE_DELAY);
+
+  Simulation &simulation_;
+  FifoUART &uart_;
+  FifoUART *ac_tap_ = nullptr;
+  FifoUART *controller_tap_ = nullptr;
+  bool connected_ = true;
+  size_t frames_received_ = 0;
+  size_t frames_sent_ = 0;
+};
+
+/*
+ * CZ-TACG1 adapter port of an AC, CN-CNT
+ *
+ * Answers every poll with the documented poll response carrying state and the sensor values below. Control frames
+ * replace the state, the AC does not answer them, the next poll response confirms them.
+ */
+class CNTAC : public SimulatedAC {
+ public:
+  CNTAC(Simulation &simulation, FifoUART &uart);
+
+  esphome::panasonic_ac::CNT::State state;
+  int8_t inside_temperature = 22;
+  int8_t outside_temperature = 25;
+  uint16_t power_consumption = 567;
+
+  size_t polls = 0;
+  size_t commands = 0;
+
+  std::vector<uint8_t> poll_response() const;
+
+ protected:
+  void on_frame(const std::vector<uint8_t> &frame) override;
+};
+
+/*
+ * DNSK-P11 wifi adapter port of an AC, CN-WLAN
+ *
+ * Answers every frame of the driver that is not itself an answer with its type | 0x80 and the counter of the frame.
+ * The answer of the third last handshake step is followed by the two unsolicited packets that end the handshake, the
+ * answer of a poll is the captured query response carrying the values below. Set commands change the values and are
+ * followed by a report of them, which is resent until the driver acknowledges it. Once the handshake is done the AC
+ * pings every PING_INTERVAL. Unsolicited packets carry the counter of the AC.
+ *
+ * After power on the AC sends a sync packet, its content is not documented, the simulation only fills in the header.
+ */
+class WLANAC : public SimulatedAC {
+ public:
+  static const uint32_t PING_INTERVAL = 60000;
+  static const uint32_t REPORT_RESEND_INTERVAL = 1000;
+  static const uint8_t REPORT_RESENDS = 3;
+
+  WLANAC(Simulation &simulation, FifoUART &uart);
+
+  void power_on();                                        // Sends the sync packet
+  void change(const std::map<uint8_t, uint8_t> &values);  // Changed on the AC itself, e.g. by the remote
+  uint8_t get(uint8_t key) const { return this->values.at(key); }
+
+  std::map<uint8_t, uint8_t> values;  // Key -> value of the query response and the reports
+  uint8_t counter = 0x01;             // Counter of the next unsolicited packet
+
+  bool ready = false;  // Handshake done
+  size_t polls = 0;
+  size_t set_commands = 0;
+  size_t pings = 0;
+  size_t ping_answers = 0;
+  size_t reports = 0;
+  size_t report_acks = 0;
+
+  std::vector<uint8_t> query_response(uint8_t counter) const;
+
+ protected:
+  void on_frame(const std::vector<uint8_t> &frame) override;
+
+  void answer(const std::vector<uint8_t> &frame);
+  void send_unsolicited(uint8_t type_high, uint8_t type_low);
+  void send_report(const std::map<uint8_t, uint8_t> &values);
+  void resend_report(std::vector<uint8_t> report, uint8_t resends);
+  void ping();
+
+  uint8_t unacked_report_ = 0;  // Counter of the report resent until it is acknowledged, 0 if none
+};
+
+}  // namespace sim
@@ -0,0 +1,75 @@
+#include "simulation.h"
+
+#include <algorithm>
+
+namespace sim {
+
+using esphome::host::time_us;
+
+void Simulation::at(uint64_t time, Action action) {
+  this->queue_.push({std::max(time, time_us()), this->sequence_++, std::move(action)});
+}
+
+/*
+ * Earliest event or component deadline, at most end
+ */
+uint64_t Simulation::next_wake_up(uint64_t now, uint64_t end) {
+  uint64_t next = end;
+
+  if (!this->queue_.empty())
+    next = std::min(next, this->queue_.top().time);
+
+  for (const auto &component : this->components_) {
+    uint32_t wait = component.time_to_next_deadline();
+    if (wait == UINT32_MAX)
+      continue;  // No timer armed
+
+    // Deadlines are whole milliseconds of millis(), the component sees them at the start of that millisecond
+    uint64_t deadline = (now / 1000 + wait) * 1000;
+    if (this->loops_ > 0 && deadline <= this->last_loop_)
+      deadline = (now / 1000 + 1) * 1000;  // Still due after the last loop, ESPHome would loop again soon
+
+    next = std::min(next, std::max(deadline, now));
+  }
+
+  return next;
+}
+
+void Simulation::run_until(uint64_t end) {
+  for (;;) {
+    uint64_t now = time_us();
+    uint64_t next = this->next_wake_up(now, end);
+
+    if (next > now)
+      esphome::host::set_time_us(next);
+
+    while (!this->queue_.empty() && this->queue_.top().time <= next) {
+      Action action = this->queue_.top().action;
+      this->queue_.pop();
+      action();
+      this->events_run_++;
+    }
+
+    for (const auto &component : this->components_)
+      component.loop();
+
+    this->last_loop_ = next;
+    this->loops_++;
+
+    if (next >= end)
+      return;
+  }
+}
+
+uint64_t Simulation::run_due() {
+  while (!this->queue_.empty() && this->queue_.top().time <= time_us()) {
+    Action action = this->queue_.top().action;
+    this->queue_.pop();
+    action();
+    this->events_run_++;
+  }
+
+  return this->queue_.empty() ? UINT64_MAX : this->queue_.top().time;
+}
+
+}  // namespace sim
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "host.h"
+
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <vector>
+
+namespace sim {
+
+/*
+ * Discrete event simulation on the simulated host clock
+ *
+ * Events are scheduled at absolute times in microseconds. Components are looped after every event and whenever the
+ * deadline reported by their get_time_to_next_deadline() is reached, time jumps straight from one to the next. A
+ * component that forgets to arm a timer for pending work therefore stalls here instead of being rescued by the
+ * frequent loop() calls of ESPHome, which is what the tests want to find.
+ */
+class Simulation {
+ public:
+  using Action = std::function<void()>;
+
+  // component must have loop() and get_time_to_next_deadline()
+  template<typename Component> void add_component(Component *component) {
+    this->components_.push_back({[component] { component->loop(); },
+                                 [component] { return component->get_time_to_next_deadline(); }});
+  }
+
+  void at(uint64_t time, Action action);
+  void after_us(uint64_t delay, Action action) { this->at(esphome::host::time_us() + delay, std::move(action)); }
+  void after_ms(uint64_t delay, Action action) { this->after_us(delay * 1000, std::move(action)); }
+
+  // Runs events and components until time, which is the host time afterwards
+  void run_until(uint64_t time);
+  void run_for_ms(uint64_t duration) { this->run_until(esphome::host::time_us() + duration * 1000); }
+
+  // Runs the events due at the host time and returns the time of the next one, for a simulation on the real clock
+  uint64_t run_due();
+
+  uint64_t loops() const { return this->loops_; }
+  uint64_t events() const { return this->events_run_; }
+
+ protected:
+  struct Event {
+    uint64_t time;
+    uint64_t sequence;  // Keeps events scheduled for the same time in order
+    Action action;
+  };
+
+  struct Later {
+    bool operator()(const Event &a, const Event &b) const {
+      return a.time != b.time ? a.time > b.time : a.sequence > b.sequence;
+    }
+  };
+
+  struct Component {
+    std::function<void()> loop;
+    std::function<uint32_t()> time_to_next_deadline;
+  };
+
+  uint64_t next_wake_up(uint64_t now, uint64_t end);
+
+  std::priority_queue<Event, std::vector<Event>, Later> queue_;
+  std::vector<Component> components_;
+  uint64_t sequence_ = 0;
+  uint64_t last_loop_ = 0;  // Time of the last loop, a deadline that is still due then waits for the next ms
+  uint64_t loops_ = 0;
+  uint64_t events_run_ = 0;
+};
+
+}  // namespace sim
@@ -0,0 +1,304 @@
+/*
+ * Host test of both drivers over a simulated day, run by the discrete event simulation in tests/sim
+ *
+ * Built by the host build in CMakeLists.txt and run by ctest. The day starts six hours before millis() wraps around,
+ * micros() wraps every 71 minutes, so every timer crosses both rollovers. During the day the user changes the state
+ * a few times, the AC changes its sensor values and the link is cut for a few minutes at noon. Each day checks the
+ * poll cadence, that every change reaches the other side, that the driver recovers after the link is back and that
+ * nothing was logged as a warning that should not be. The CN-WLAN day also checks the pings, reports and the packet
+ * counters, which roll over several times a day. Protocol detection is checked for both protocols on its own.
+ *
+ *   simulated_day_test [-v]
+ *
+ * -v prints the log of the drivers at DEBUG level.
+ */
+
+#include "sim/simulated_ac.h"
+#include "sim/simulation.h"
+
+#include "esppac_auto.h"
+#include "esppac_cnt.h"
+#include "esppac_wlan.h"
+
+#include "host.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+using namespace esphome;
+using namespace esphome::panasonic_ac;
+
+static int failures = 0;
+
+#define CHECK(condition) \
+  do { \
+    if (!(condition)) { \
+      fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+      failures++; \
+    } \
+  } while (0)
+
+static const uint64_t HOUR_MS = 60 * 60 * 1000;
+static const uint64_t DAY_MS = 24 * HOUR_MS;
+static const uint64_t START_US = ((1ULL << 32) - 6 * HOUR_MS) * 1000;  // millis() wraps at 06:00
+static const uint64_t OUTAGE_START_MS = 12 * HOUR_MS;
+static const uint64_t OUTAGE_MS = 3 * 60 * 1000;
+
+static bool verbose = false;
+
+/*
+ * Counts the warnings and errors logged, messages containing one of the expected strings are only counted separately
+ */
+struct LogCounter {
+  std::vector<std::string> expected;
+  size_t unexpected = 0;
+  size_t expected_count = 0;
+
+  LogCounter() {
+    host::set_log_level(verbose ? ESPHOME_LOG_LEVEL_DEBUG : ESPHOME_LOG_LEVEL_WARN);
+    host::set_log_sink([this](int level, const char *tag, const char *message) {
+      if (verbose)
+        fprintf(stderr, "%12.3f [%d][%s]: %s\n", hours(), level, tag, message);
+
+      if (level > ESPHOME_LOG_LEVEL_WARN)
+        return;
+
+      for (const auto &text : this->expected) {
+        if (strstr(message, text.c_str()) != nullptr) {
+          this->expected_count++;
+          return;
+        }
+      }
+
+      if (!verbose)
+        fprintf(stderr, "%12.3f [%d][%s]: %s\n", hours(), level, tag, message);
+      this->unexpected++;
+    });
+  }
+
+  ~LogCounter() { host::reset_log_sink(); }
+
+  static double hours() { return (double) (host::time_us() - START_US) / 3.6e9; }
+};
+
+static uint64_t at(uint64_t ms) { return START_US + ms * 1000; }
+
+static double elapsed_ms(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void test_cnt_day() {
+  host::set_time_us(START_US);
+  LogCounter log;
+
+  sim::Simulation simulation;
+  uart::FifoUART uart;
+  sim::CNTAC ac(simulation, uart);
+
+  CNT::PanasonicACCNT driver;
+  driver.set_uart_parent(&uart);
+  driver.setup();
+  simulation.add_component(&driver);
+
+  size_t publishes = 0, publishes_after_outage = 0;
+  driver.add_on_state_callback([&](climate::Climate &) {
+    publishes++;
+    if (host::time_us() > at(OUTAGE_START_MS + OUTAGE_MS))
+      publishes_after_outage++;
+  });
+
+  // Sensor values of the AC, the inside temperature changes every 20 minutes and the outside one every hour
+  for (uint64_t minute = 0; minute < 24 * 60; minute += 20) {
+    simulation.at(at(minute * 60000), [&ac, minute] {
+      ac.inside_temperature = 21 + (minute / 20) % 3;
+      ac.outside_temperature = 10 + (minute / 60) % 12;
+    });
+  }
+
+  simulation.at(at(7 * HOUR_MS), [&driver] {
+    driver.make_call().set_mode(climate::CLIMATE_MODE_HEAT).set_target_temperature(22.5).perform();
+  });
+  simulation.at(at(OUTAGE_START_MS), [&ac] { ac.set_connected(false); });
+  simulation.at(at(OUTAGE_START_MS + OUTAGE_MS), [&ac] { ac.set_connected(true); });
+  simulation.at(at(18 * HOUR_MS), [&driver] { driver.make_call().set_target_temperature(24).perform(); });
+  simulation.at(at(23 * HOUR_MS), [&driver] { driver.make_call().set_mode(climate::CLIMATE_MODE_OFF).perform(); });
+
+  auto start = std::chrono::steady_clock::now();
+
+  simulation.run_until(at(7 * HOUR_MS + 10000));
+  CHECK(ac.state.power());
+  CHECK(ac.state.mode() == CNT::MODE_HEAT);
+  CHECK(ac.state.target_temperature() == 45);
+  CHECK(driver.mode == climate::CLIMATE_MODE_HEAT);
+  CHECK(driver.target_temperature == 22.5f);
+
+  simulation.run_until(at(18 * HOUR_MS + 10000));
+  CHECK(ac.state.target_temperature() == 48);
+  CHECK(ac.state.mode() == CNT::MODE_HEAT);  // Unchanged fields are kept
+  CHECK(driver.target_temperature == 24);
+  CHECK(driver.current_temperature == ac.inside_temperature);
+
+  simulation.run_until(at(DAY_MS));
+  CHECK(!ac.state.power());
+  CHECK(driver.mode == climate::CLIMATE_MODE_OFF);
+
+  double wall = elapsed_ms(start);
+
+  // A poll every POLL_INTERVAL, each command moves the next poll back, polls sent during the outage are lost
+  size_t polls_per_day = DAY_MS / CNT::POLL_INTERVAL;
+  size_t lost = OUTAGE_MS / CNT::POLL_INTERVAL;
+  CHECK(ac.polls <= polls_per_day && ac.polls + lost + 10 >= polls_per_day);
+  CHECK(ac.commands == 3);
+  CHECK(publishes_after_outage > 0);
+  CHECK(log.unexpected == 0);
+  CHECK(millis() < (uint32_t) (START_US / 1000));  // millis() wrapped
+
+  printf("CN-CNT day: %zu polls, %zu commands, %zu publishes, %llu loops, %llu events, %.1f ms\n", ac.polls,
+         ac.commands, publishes, (unsigned long long) simulation.loops(), (unsigned long long) simulation.events(),
+         wall);
+}
+
+static void test_wlan_day() {
+  host::set_time_us(START_US);
+  LogCounter log;
+  log.expected = {"Correcting shifted"};  // Pings that cross a poll and those lost in the outage
+
+  sim::Simulation simulation;
+  uart::FifoUART uart;
+  sim::WLANAC ac(simulation, uart);
+
+  WLAN::PanasonicACWLAN driver;
+  driver.set_uart_parent(&uart);
+  driver.setup();
+  simulation.add_component(&driver);
+
+  size_t publishes = 0, publishes_after_outage = 0;
+  driver.add_on_state_callback([&](climate::Climate &) {
+    publishes++;
+    if (host::time_us() > at(OUTAGE_START_MS + OUTAGE_MS))
+      publishes_after_outage++;
+  });
+
+  for (uint64_t minute = 0; minute < 24 * 60; minute += 20) {
+    simulation.at(at(minute * 60000), [&ac, minute] { ac.values[0xBB] = 21 + (minute / 20) % 3; });
+  }
+
+  uint8_t cool = find_mode(WLAN::MODES, climate::CLIMATE_MODE_COOL)->value;
+
+  simulation.at(at(1000), [&ac] { ac.power_on(); });
+  simulation.at(at(7 * HOUR_MS), [&driver] {
+    driver.make_call().set_mode(climate::CLIMATE_MODE_COOL).set_target_temperature(22.5).perform();
+  });
+  // Turned off with the remote, the AC reports it
+  simulation.at(at(9 * HOUR_MS), [&ac] { ac.change({{WLAN::KEY_POWER, WLAN::POWER_OFF}}); });
+  simulation.at(at(OUTAGE_START_MS), [&ac] { ac.set_connected(false); });
+  simulation.at(at(OUTAGE_START_MS + OUTAGE_MS), [&ac] { ac.set_connected(true); });
+  simulation.at(at(18 * HOUR_MS), [&driver] {
+    driver.make_call().set_mode(climate::CLIMATE_MODE_COOL).set_swing_mode(climate::CLIMATE_SWING_VERTICAL).perform();
+  });
+
+  auto start = std::chrono::steady_clock::now();
+
+  // The sync packet starts the handshake right away instead of after INIT_TIMEOUT, it ends after INIT_END_TIMEOUT
+  simulation.run_until(at(WLAN::INIT_TIMEOUT + 5000));
+  CHECK(ac.ready);
+
+  simulation.run_until(at(7 * HOUR_MS + 10000));
+  CHECK(ac.get(WLAN::KEY_POWER) == WLAN::POWER_ON);
+  CHECK(ac.get(WLAN::KEY_MODE) == cool);
+  CHECK(ac.get(WLAN::KEY_TARGET_TEMPERATURE) == 45);
+  CHECK(driver.mode == climate::CLIMATE_MODE_COOL);
+  CHECK(driver.target_temperature == 22.5f);
+
+  simulation.run_until(at(9 * HOUR_MS + 10000));
+  CHECK(driver.mode == climate::CLIMATE_MODE_OFF);
+
+  // Polled once per ping, see below
+  simulation.run_until(at(18 * HOUR_MS + sim::WLANAC::PING_INTERVAL + 10000));
+  CHECK(ac.get(WLAN::KEY_POWER) == WLAN::POWER_ON);
+  CHECK(ac.get(WLAN::KEY_HORIZONTAL_SWING) == WLAN::SWING_CENTER);  // The axis that stops swinging is centered
+  CHECK(driver.swing_mode == climate::CLIMATE_SWING_VERTICAL);
+  CHECK(driver.current_temperature == ac.get(0xBB));
+
+  simulation.run_until(at(DAY_MS));
+
+  double wall = elapsed_ms(start);
+
+  // Every packet sent moves the next poll back by POLL_INTERVAL, including the answers to the pings. With a ping
+  // every PING_INTERVAL the AC is polled once per ping.
+  size_t pings_per_day = DAY_MS / sim::WLANAC::PING_INTERVAL;
+  size_t lost = OUTAGE_MS / sim::WLANAC::PING_INTERVAL;
+  CHECK(ac.polls <= pings_per_day && ac.polls + lost + 10 >= pings_per_day);
+  CHECK(ac.set_commands == 2);
+  CHECK(ac.pings + 2 >= pings_per_day);
+  CHECK(ac.ping_answers + lost + 1 >= ac.pings);  // The pings sent during the outage are lost
+  CHECK(ac.report_acks == ac.reports);
+  CHECK(ac.pings + ac.reports > 2 * 254);  // The counter of the AC rolled over at least twice
+  CHECK(publishes_after_outage > 0);
+  CHECK(log.unexpected == 0);
+  CHECK(millis() < (uint32_t) (START_US / 1000));
+
+  printf("CN-WLAN day: %zu polls, %zu set commands, %zu pings, %zu reports, %zu publishes, %zu counter corrections, "
+         "%llu loops, %llu events, %.1f ms\n",
+         ac.polls, ac.set_commands, ac.pings, ac.reports, publishes, log.expected_count,
+         (unsigned long long) simulation.loops(), (unsigned long long) simulation.events(), wall);
+}
+
+/*
+ * Protocol detection followed by the first state of the driver
+ */
+
+static PanasonicACAuto *detection_components[2];
+static size_t detection_count = 0;
+
+template<typename AC> static void test_detection(const char *protocol) {
+  host::set_time_us(START_US);
+  host::clear_preferences();
+  LogCounter log;
+
+  sim::Simulation simulation;
+  uart::FifoUART uart;
+  AC ac(simulation, uart);
+
+  // Lives as long as the program like on the ESP, so does the driver it creates
+  auto *climate = new PanasonicACAuto();
+  detection_components[detection_count++] = climate;
+  climate->set_uart_parent(&uart);
+  climate->setup();
+  simulation.add_component(climate);
+
+  uint64_t first_publish = 0;
+  climate->add_on_state_callback([&first_publish](climate::Climate &) {
+    if (first_publish == 0)
+      first_publish = host::time_us();
+  });
+
+  // Listening, CN-CNT probe, CN-WLAN probe, then the CN-WLAN handshake, with room to spare
+  simulation.run_until(at(PROBE_LISTEN_TIMEOUT + 2 * PROBE_RESPONSE_TIMEOUT + WLAN::INIT_TIMEOUT + 5000));
+
+  CHECK(first_publish != 0);
+  // The CN-WLAN handshake starts right after the detection, without waiting for INIT_TIMEOUT
+  CHECK(first_publish < at(PROBE_LISTEN_TIMEOUT + 2 * PROBE_RESPONSE_TIMEOUT + WLAN::INIT_TIMEOUT));
+  CHECK(log.unexpected == 0);
+
+  printf("%s detection: first state published after %.1f s\n", protocol, (double) (first_publish - START_US) / 1e6);
+}
+
+int main(int argc, char **argv) {
+  verbose = argc > 1 && strcmp(argv[1], "-v") == 0;
+
+  test_cnt_day();
+  test_wlan_day();
+  test_detection<sim::CNTAC>("CN-CNT");
+  test_detection<sim::WLANAC>("CN-WLAN");
+
+  if (failures > 0) {
+    fprintf(stderr, "%d checks failed\n", failures);
+    return 1;
+  }
+
+  printf("All checks passed\n");
+  return 0;
+}
@@ -0,0 +1,215 @@
+// Generated by tools/generate_vectors.py from protocol/cztacg1/protocol_description_query.ods, do not edit
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace vectors {
+
+static const std::vector<uint8_t> CNT_QUERY_REQUEST{0x70, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86};
+
+// Poll response and the state the driver must decode from it
+struct CNTVector {
+  const char *name;
+  std::vector<uint8_t> frame;
+  const char *mode;  // climate_mode_to_string()
+  float target_temperature;
+  float current_temperature;
+  float outside_temperature;
+  const char *fan_mode;
+  const char *swing_mode;  // climate_swing_mode_to_string()
+  const char *vertical_swing;
+  const char *horizontal_swing;
+  const char *preset;
+  bool nanoex;
+  bool econavi;
+  bool mild_dry;
+  bool eco;
+};
+
+static const CNTVector CNT_VECTORS[]{
+    {"documented response",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x19, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x8C},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "up", "left", "Normal", true, false, false, false},
+    {"modes: Heat/Cool",
+     {0x70, 0x20, 0x04, 0x2B, 0x80, 0x50, 0x19, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0xBC},
+     "HEAT_COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "up", "left", "Normal", true, false, false, false},
+    {"modes: Cool",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x19, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x8C},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "up", "left", "Normal", true, false, false, false},
+    {"modes: Heat",
+     {0x70, 0x20, 0x44, 0x2B, 0x80, 0x50, 0x19, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x7C},
+     "HEAT", 21.5f, 22.0f, 25.0f, "3", "OFF", "up", "left", "Normal", true, false, false, false},
+    {"modes: Dry",
+     {0x70, 0x20, 0x24, 0x2B, 0x80, 0x50, 0x19, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x9C},
+     "DRY", 21.5f, 22.0f, 25.0f, "3", "OFF", "up", "left", "Normal", true, false, false, false},
+    {"modes: Fan only",
+     {0x70, 0x20, 0x64, 0x2B, 0x80, 0x50, 0x19, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x5C},
+     "FAN_ONLY", 21.5f, 22.0f, 25.0f, "3", "OFF", "up", "left", "Normal", true, false, false, false},
+    {"modes: Off",
+     {0x70, 0x20, 0x30, 0x2B, 0x80, 0x50, 0x19, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x90},
+     "OFF", 21.5f, 22.0f, 25.0f, "3", "OFF", "up", "left", "Normal", true, false, false, false},
+    {"fan speeds: Auto",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0xA0, 0x19, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x3C},
+     "COOL", 21.5f, 22.0f, 25.0f, "Automatic", "OFF", "up", "left", "Normal", true, false, false, false},
+    {"fan speeds: 1",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x30, 0x19, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0xAC},
+     "COOL", 21.5f, 22.0f, 25.0f, "1", "OFF", "up", "left", "Normal", true, false, false, false},
+    {"fan speeds: 2",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x40, 0x19, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x9C},
+     "COOL", 21.5f, 22.0f, 25.0f, "2", "OFF", "up", "left", "Normal", true, false, false, false},
+    {"fan speeds: 3",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x19, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x8C},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "up", "left", "Normal", true, false, false, false},
+    {"fan speeds: 4",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x60, 0x19, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x7C},
+     "COOL", 21.5f, 22.0f, 25.0f, "4", "OFF", "up", "left", "Normal", true, false, false, false},
+    {"fan speeds: 5",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x70, 0x19, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x6C},
+     "COOL", 21.5f, 22.0f, 25.0f, "5", "OFF", "up", "left", "Normal", true, false, false, false},
+    {"swing mode: auto auto",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0xFD, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0xA8},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "BOTH", "auto", "auto", "Normal", true, false, false, false},
+    {"swing mode: auto left",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0xF9, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0xAC},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "VERTICAL", "auto", "left", "Normal", true, false, false, false},
+    {"swing mode: auto left_center",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0xFA, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0xAB},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "VERTICAL", "auto", "left_center", "Normal", true, false, false, false},
+    {"swing mode: auto center",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0xF6, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0xAF},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "VERTICAL", "auto", "center", "Normal", true, false, false, false},
+    {"swing mode: auto right_center",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0xFB, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0xAA},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "VERTICAL", "auto", "right_center", "Normal", true, false, false, false},
+    {"swing mode: auto right",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0xFC, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0xA9},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "VERTICAL", "auto", "right", "Normal", true, false, false, false},
+    {"swing mode: up auto",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x1D, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x88},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "HORIZONTAL", "up", "auto", "Normal", true, false, false, false},
+    {"swing mode: up left",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x19, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x8C},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "up", "left", "Normal", true, false, false, false},
+    {"swing mode: up left_center",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x1A, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x8B},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "up", "left_center", "Normal", true, false, false, false},
+    {"swing mode: up center",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x16, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x8F},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "up", "center", "Normal", true, false, false, false},
+    {"swing mode: up right_center",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x1B, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x8A},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "up", "right_center", "Normal", true, false, false, false},
+    {"swing mode: up right",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x1C, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x89},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "up", "right", "Normal", true, false, false, false},
+    {"swing mode: up_center auto",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x2D, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x78},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "HORIZONTAL", "up_center", "auto", "Normal", true, false, false, false},
+    {"swing mode: up_center left",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x29, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x7C},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "up_center", "left", "Normal", true, false, false, false},
+    {"swing mode: up_center left_center",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x2A, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x7B},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "up_center", "left_center", "Normal", true, false, false, false},
+    {"swing mode: up_center center",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x26, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x7F},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "up_center", "center", "Normal", true, false, false, false},
+    {"swing mode: up_center right_center",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x2B, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x7A},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "up_center", "right_center", "Normal", true, false, false, false},
+    {"swing mode: up_center right",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x2C, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x79},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "up_center", "right", "Normal", true, false, false, false},
+    {"swing mode: center auto",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x3D, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x68},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "HORIZONTAL", "center", "auto", "Normal", true, false, false, false},
+    {"swing mode: center left",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x39, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x6C},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "center", "left", "Normal", true, false, false, false},
+    {"swing mode: center left_center",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x3A, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x6B},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "center", "left_center", "Normal", true, false, false, false},
+    {"swing mode: center center",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x36, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x6F},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "center", "center", "Normal", true, false, false, false},
+    {"swing mode: center right_center",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x3B, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x6A},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "center", "right_center", "Normal", true, false, false, false},
+    {"swing mode: center right",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x3C, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x69},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "center", "right", "Normal", true, false, false, false},
+    {"swing mode: down_center auto",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x4D, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x58},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "HORIZONTAL", "down_center", "auto", "Normal", true, false, false, false},
+    {"swing mode: down_center left",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x49, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x5C},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "down_center", "left", "Normal", true, false, false, false},
+    {"swing mode: down_center left_center",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x4A, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x5B},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "down_center", "left_center", "Normal", true, false, false, false},
+    {"swing mode: down_center center",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x46, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x5F},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "down_center", "center", "Normal", true, false, false, false},
+    {"swing mode: down_center right_center",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x4B, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x5A},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "down_center", "right_center", "Normal", true, false, false, false},
+    {"swing mode: down_center right",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x4C, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x59},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "down_center", "right", "Normal", true, false, false, false},
+    {"swing mode: down auto",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x5D, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x48},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "HORIZONTAL", "down", "auto", "Normal", true, false, false, false},
+    {"swing mode: down left",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x59, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x4C},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "down", "left", "Normal", true, false, false, false},
+    {"swing mode: down left_center",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x5A, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x4B},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "down", "left_center", "Normal", true, false, false, false},
+    {"swing mode: down center",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x56, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x4F},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "down", "center", "Normal", true, false, false, false},
+    {"swing mode: down right_center",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x5B, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x4A},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "down", "right_center", "Normal", true, false, false, false},
+    {"swing mode: down right",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x5C, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x49},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "down", "right", "Normal", true, false, false, false},
+    {"presets: Normal",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x19, 0x00, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0xCC},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "up", "left", "Normal", false, false, false, false},
+    {"presets: Powerful",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x19, 0x02, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0xCA},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "up", "left", "Powerful", false, false, false, false},
+    {"presets: Quiet",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x19, 0x04, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0xC8},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "up", "left", "Quiet", false, false, false, false},
+    {"presets: Normal+nanoex",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x19, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x8C},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "up", "left", "Normal", true, false, false, false},
+    {"presets: Powerful+nanoex",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x19, 0x42, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x8A},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "up", "left", "Powerful", true, false, false, false},
+    {"presets: Quiet+nanoex",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x19, 0x44, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x88},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "up", "left", "Quiet", true, false, false, false},
+    {"presets: Econavi",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x19, 0x10, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0xBC},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "up", "left", "Normal", false, true, false, false},
+    {"mild dry: Off",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x19, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x8C},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "up", "left", "Normal", true, false, false, false},
+    {"mild dry: On",
+     {0x70, 0x20, 0x34, 0x2B, 0x7F, 0x50, 0x19, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x8D},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "up", "left", "Normal", true, false, true, false},
+    {"eco mode: Off",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x19, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x8C},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "up", "left", "Normal", true, false, false, false},
+    {"eco mode: On",
+     {0x70, 0x20, 0x34, 0x2B, 0x80, 0x50, 0x19, 0x40, 0x00, 0x40, 0x40, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x20, 0x85, 0x16, 0x19, 0xFF, 0x16, 0x19, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x47, 0x02, 0x10, 0x80, 0x03, 0x55, 0x4C},
+     "COOL", 21.5f, 22.0f, 25.0f, "3", "OFF", "up", "left", "Normal", true, false, false, true},
+};
+
+}  // namespace vectors
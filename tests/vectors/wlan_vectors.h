@@ -0,0 +1,247 @@
+// Generated by tools/generate_vectors.py from the captures in protocol/logic_analyzer/controller/ and protocol/protocol_description_controller.ods, do not edit
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace vectors {
+
+// Frame of a capture and, after the frames of the AC that carry state, the state reported by the AC so far. Fields the
+// AC has not reported yet are nullptr, NAN or -1.
+struct WLANFrame {
+  uint32_t time;  // Microseconds since the first frame
+  bool outgoing;  // Sent by the adapter
+  std::vector<uint8_t> data;
+  bool checked;      // The state below is checked after this frame
+  const char *mode;  // climate_mode_to_string()
+  float target_temperature;
+  float current_temperature;
+  float outside_temperature;
+  const char *fan_mode;
+  const char *swing_mode;  // climate_swing_mode_to_string()
+  const char *vertical_swing;
+  const char *horizontal_swing;
+  const char *preset;
+  int nanoex;
+};
+
+struct WLANCapture {
+  const char *name;
+  std::vector<WLANFrame> frames;
+};
+
+static const WLANCapture WLAN_CAPTURES[]{
+    {"air_swing_down-up_auto.dsl",
+     {
+         {0, true, {0x5A, 0x51, 0x10, 0x08, 0x00, 0x0D, 0x01, 0x01, 0x30, 0x01, 0x02, 0x00, 0xA1, 0x01, 0x42, 0x00, 0xA4, 0x01, 0x42, 0x30}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {54600, false, {0x5A, 0x51, 0x10, 0x88, 0x00, 0x0B, 0x00, 0x01, 0x30, 0x01, 0x02, 0x00, 0xA1, 0x00, 0x00, 0xA4, 0x00, 0x39}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {162600, false, {0x5A, 0x24, 0x10, 0x0A, 0x00, 0x0D, 0x00, 0x01, 0x30, 0x01, 0x02, 0x00, 0xA1, 0x01, 0x42, 0x00, 0xA4, 0x01, 0x42, 0x5C}, true, nullptr, NAN, NAN, NAN, nullptr, "OFF", "down", nullptr, nullptr, -1},
+         {213670, true, {0x5A, 0x24, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0xB2}, false, nullptr, NAN, NAN, NAN, nullptr, "OFF", "down", nullptr, nullptr, -1},
+         {6874190, true, {0x5A, 0x52, 0x10, 0x08, 0x00, 0x09, 0x01, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA4, 0x01, 0x45, 0x15}, false, nullptr, NAN, NAN, NAN, nullptr, "OFF", "down", nullptr, nullptr, -1},
+         {6963540, false, {0x5A, 0x52, 0x10, 0x88, 0x00, 0x08, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA4, 0x00, 0xDD}, false, nullptr, NAN, NAN, NAN, nullptr, "OFF", "down", nullptr, nullptr, -1},
+         {7070400, false, {0x5A, 0x25, 0x10, 0x0A, 0x00, 0x09, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA4, 0x01, 0x45, 0x41}, true, nullptr, NAN, NAN, NAN, nullptr, "OFF", "down_center", nullptr, nullptr, -1},
+         {7138900, true, {0x5A, 0x25, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0xB1}, false, nullptr, NAN, NAN, NAN, nullptr, "OFF", "down_center", nullptr, nullptr, -1},
+         {12101890, true, {0x5A, 0x53, 0x10, 0x08, 0x00, 0x09, 0x01, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA4, 0x01, 0x43, 0x16}, false, nullptr, NAN, NAN, NAN, nullptr, "OFF", "down_center", nullptr, nullptr, -1},
+         {12172890, false, {0x5A, 0x53, 0x10, 0x88, 0x00, 0x08, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA4, 0x00, 0xDC}, false, nullptr, NAN, NAN, NAN, nullptr, "OFF", "down_center", nullptr, nullptr, -1},
+         {12279800, false, {0x5A, 0x26, 0x10, 0x0A, 0x00, 0x09, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA4, 0x01, 0x43, 0x42}, true, nullptr, NAN, NAN, NAN, nullptr, "OFF", "center", nullptr, nullptr, -1},
+         {12314830, true, {0x5A, 0x26, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0xB0}, false, nullptr, NAN, NAN, NAN, nullptr, "OFF", "center", nullptr, nullptr, -1},
+         {17283650, true, {0x5A, 0x54, 0x10, 0x08, 0x00, 0x09, 0x01, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA4, 0x01, 0x44, 0x14}, false, nullptr, NAN, NAN, NAN, nullptr, "OFF", "center", nullptr, nullptr, -1},
+         {17382430, false, {0x5A, 0x54, 0x10, 0x88, 0x00, 0x08, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA4, 0x00, 0xDB}, false, nullptr, NAN, NAN, NAN, nullptr, "OFF", "center", nullptr, nullptr, -1},
+         {17489300, false, {0x5A, 0x27, 0x10, 0x0A, 0x00, 0x09, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA4, 0x01, 0x44, 0x40}, true, nullptr, NAN, NAN, NAN, nullptr, "OFF", "up_center", nullptr, nullptr, -1},
+         {17527530, true, {0x5A, 0x27, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0xAF}, false, nullptr, NAN, NAN, NAN, nullptr, "OFF", "up_center", nullptr, nullptr, -1},
+         {22287380, true, {0x5A, 0x55, 0x10, 0x08, 0x00, 0x09, 0x01, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA4, 0x01, 0x41, 0x16}, false, nullptr, NAN, NAN, NAN, nullptr, "OFF", "up_center", nullptr, nullptr, -1},
+         {22391650, false, {0x5A, 0x55, 0x10, 0x88, 0x00, 0x08, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA4, 0x00, 0xDA}, false, nullptr, NAN, NAN, NAN, nullptr, "OFF", "up_center", nullptr, nullptr, -1},
+         {22498520, false, {0x5A, 0x28, 0x10, 0x0A, 0x00, 0x09, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA4, 0x01, 0x41, 0x42}, true, nullptr, NAN, NAN, NAN, nullptr, "OFF", "up", nullptr, nullptr, -1},
+         {22552190, true, {0x5A, 0x28, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0xAE}, false, nullptr, NAN, NAN, NAN, nullptr, "OFF", "up", nullptr, nullptr, -1},
+         {27579050, true, {0x5A, 0x56, 0x10, 0x08, 0x00, 0x09, 0x01, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA1, 0x01, 0x43, 0x16}, false, nullptr, NAN, NAN, NAN, nullptr, "OFF", "up", nullptr, nullptr, -1},
+         {27701390, false, {0x5A, 0x56, 0x10, 0x88, 0x00, 0x08, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA1, 0x00, 0xDC}, false, nullptr, NAN, NAN, NAN, nullptr, "OFF", "up", nullptr, nullptr, -1},
+         {27812980, false, {0x5A, 0x29, 0x10, 0x0A, 0x00, 0x0D, 0x00, 0x01, 0x30, 0x01, 0x02, 0x00, 0xA1, 0x01, 0x43, 0x00, 0xA4, 0x01, 0x43, 0x55}, true, nullptr, NAN, NAN, NAN, nullptr, "VERTICAL", "center", nullptr, nullptr, -1},
+         {27872190, true, {0x5A, 0x29, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0xAD}, false, nullptr, NAN, NAN, NAN, nullptr, "VERTICAL", "center", nullptr, nullptr, -1},
+     }},
+    {"air_swing_left-right_auto.dsl",
+     {
+         {0, true, {0x5A, 0x5E, 0x10, 0x08, 0x00, 0x11, 0x01, 0x01, 0x30, 0x01, 0x03, 0x00, 0xA1, 0x01, 0x42, 0x00, 0xA5, 0x01, 0x42, 0x02, 0x35, 0x01, 0x42, 0xA3}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {115970, false, {0x5A, 0x5E, 0x10, 0x88, 0x00, 0x0E, 0x00, 0x01, 0x30, 0x01, 0x03, 0x00, 0xA1, 0x00, 0x00, 0xA5, 0x00, 0x02, 0x35, 0x00, 0xF0}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {220350, false, {0x5A, 0x2F, 0x10, 0x0A, 0x00, 0x0D, 0x00, 0x01, 0x30, 0x01, 0x02, 0x00, 0xA1, 0x01, 0x42, 0x00, 0xA5, 0x01, 0x42, 0x50}, true, nullptr, NAN, NAN, NAN, nullptr, "OFF", nullptr, "left", nullptr, -1},
+         {243670, true, {0x5A, 0x2F, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0xA7}, false, nullptr, NAN, NAN, NAN, nullptr, "OFF", nullptr, "left", nullptr, -1},
+         {5743060, true, {0x5A, 0x5F, 0x10, 0x08, 0x00, 0x0D, 0x01, 0x01, 0x30, 0x01, 0x02, 0x00, 0xA5, 0x01, 0x5C, 0x02, 0x35, 0x01, 0x42, 0x71}, false, nullptr, NAN, NAN, NAN, nullptr, "OFF", nullptr, "left", nullptr, -1},
+         {5823240, false, {0x5A, 0x5F, 0x10, 0x88, 0x00, 0x0B, 0x00, 0x01, 0x30, 0x01, 0x02, 0x00, 0xA5, 0x00, 0x02, 0x35, 0x00, 0x94}, false, nullptr, NAN, NAN, NAN, nullptr, "OFF", nullptr, "left", nullptr, -1},
+         {5926480, false, {0x5A, 0x30, 0x10, 0x0A, 0x00, 0x09, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA5, 0x01, 0x5C, 0x1E}, true, nullptr, NAN, NAN, NAN, nullptr, "OFF", nullptr, "left_center", nullptr, -1},
+         {5966200, true, {0x5A, 0x30, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0xA6}, false, nullptr, NAN, NAN, NAN, nullptr, "OFF", nullptr, "left_center", nullptr, -1},
+         {11234840, true, {0x5A, 0x60, 0x10, 0x08, 0x00, 0x0D, 0x01, 0x01, 0x30, 0x01, 0x02, 0x00, 0xA5, 0x01, 0x43, 0x02, 0x35, 0x01, 0x42, 0x89}, false, nullptr, NAN, NAN, NAN, nullptr, "OFF", nullptr, "left_center", nullptr, -1},
+         {11333530, false, {0x5A, 0x60, 0x10, 0x88, 0x00, 0x0B, 0x00, 0x01, 0x30, 0x01, 0x02, 0x00, 0xA5, 0x00, 0x02, 0x35, 0x00, 0x93}, false, nullptr, NAN, NAN, NAN, nullptr, "OFF", nullptr, "left_center", nullptr, -1},
+         {11436860, false, {0x5A, 0x31, 0x10, 0x0A, 0x00, 0x09, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA5, 0x01, 0x43, 0x36}, true, nullptr, NAN, NAN, NAN, nullptr, "OFF", nullptr, "center", nullptr, -1},
+         {11487990, true, {0x5A, 0x31, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0xA5}, false, nullptr, NAN, NAN, NAN, nullptr, "OFF", nullptr, "center", nullptr, -1},
+         {16172520, true, {0x5A, 0x61, 0x10, 0x08, 0x00, 0x0D, 0x01, 0x01, 0x30, 0x01, 0x02, 0x00, 0xA5, 0x01, 0x56, 0x02, 0x35, 0x01, 0x42, 0x75}, false, nullptr, NAN, NAN, NAN, nullptr, "OFF", nullptr, "center", nullptr, -1},
+         {16242420, false, {0x5A, 0x61, 0x10, 0x88, 0x00, 0x0B, 0x00, 0x01, 0x30, 0x01, 0x02, 0x00, 0xA5, 0x00, 0x02, 0x35, 0x00, 0x92}, false, nullptr, NAN, NAN, NAN, nullptr, "OFF", nullptr, "center", nullptr, -1},
+         {16345700, false, {0x5A, 0x32, 0x10, 0x0A, 0x00, 0x09, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA5, 0x01, 0x56, 0x22}, true, nullptr, NAN, NAN, NAN, nullptr, "OFF", nullptr, "right_center", nullptr, -1},
+         {16405670, true, {0x5A, 0x32, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0xA4}, false, nullptr, NAN, NAN, NAN, nullptr, "OFF", nullptr, "right_center", nullptr, -1},
+         {21245210, true, {0x5A, 0x62, 0x10, 0x08, 0x00, 0x0D, 0x01, 0x01, 0x30, 0x01, 0x02, 0x00, 0xA5, 0x01, 0x41, 0x02, 0x35, 0x01, 0x42, 0x89}, false, nullptr, NAN, NAN, NAN, nullptr, "OFF", nullptr, "right_center", nullptr, -1},
+         {21351850, false, {0x5A, 0x62, 0x10, 0x88, 0x00, 0x0B, 0x00, 0x01, 0x30, 0x01, 0x02, 0x00, 0xA5, 0x00, 0x02, 0x35, 0x00, 0x91}, false, nullptr, NAN, NAN, NAN, nullptr, "OFF", nullptr, "right_center", nullptr, -1},
+         {21455180, false, {0x5A, 0x33, 0x10, 0x0A, 0x00, 0x09, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA5, 0x01, 0x41, 0x36}, true, nullptr, NAN, NAN, NAN, nullptr, "OFF", nullptr, "right", nullptr, -1},
+         {21478360, true, {0x5A, 0x33, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0xA3}, false, nullptr, NAN, NAN, NAN, nullptr, "OFF", nullptr, "right", nullptr, -1},
+         {27254330, true, {0x5A, 0x63, 0x10, 0x08, 0x00, 0x09, 0x01, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA1, 0x01, 0x44, 0x08}, false, nullptr, NAN, NAN, NAN, nullptr, "OFF", nullptr, "right", nullptr, -1},
+         {27359560, false, {0x5A, 0x63, 0x10, 0x88, 0x00, 0x08, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA1, 0x00, 0xCF}, false, nullptr, NAN, NAN, NAN, nullptr, "OFF", nullptr, "right", nullptr, -1},
+         {27471050, false, {0x5A, 0x34, 0x10, 0x0A, 0x00, 0x0D, 0x00, 0x01, 0x30, 0x01, 0x02, 0x00, 0xA1, 0x01, 0x44, 0x00, 0xA5, 0x01, 0x43, 0x48}, true, nullptr, NAN, NAN, NAN, nullptr, "HORIZONTAL", nullptr, "center", nullptr, -1},
+         {27498410, true, {0x5A, 0x34, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0xA2}, false, nullptr, NAN, NAN, NAN, nullptr, "HORIZONTAL", nullptr, "center", nullptr, -1},
+     }},
+    {"air_swing_updown_both_leftright_off.dsl",
+     {
+         {0, true, {0x5A, 0x13, 0x10, 0x08, 0x00, 0x09, 0x01, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA1, 0x01, 0x43, 0x59}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {78146, false, {0x5A, 0x13, 0x10, 0x88, 0x00, 0x08, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA1, 0x00, 0x1F}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {189640, false, {0x5A, 0x02, 0x10, 0x0A, 0x00, 0x0D, 0x00, 0x01, 0x30, 0x01, 0x02, 0x00, 0xA1, 0x01, 0x43, 0x00, 0xA4, 0x01, 0x43, 0x7C}, true, nullptr, NAN, NAN, NAN, nullptr, "VERTICAL", "center", nullptr, nullptr, -1},
+         {214079, true, {0x5A, 0x02, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0xD4}, false, nullptr, NAN, NAN, NAN, nullptr, "VERTICAL", "center", nullptr, nullptr, -1},
+         {8593277, true, {0x5A, 0x14, 0x10, 0x08, 0x00, 0x09, 0x01, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA1, 0x01, 0x41, 0x5A}, false, nullptr, NAN, NAN, NAN, nullptr, "VERTICAL", "center", nullptr, nullptr, -1},
+         {8693623, false, {0x5A, 0x14, 0x10, 0x88, 0x00, 0x08, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA1, 0x00, 0x1E}, false, nullptr, NAN, NAN, NAN, nullptr, "VERTICAL", "center", nullptr, nullptr, -1},
+         {8800466, false, {0x5A, 0x03, 0x10, 0x0A, 0x00, 0x09, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA1, 0x01, 0x41, 0x6A}, true, nullptr, NAN, NAN, NAN, nullptr, "BOTH", "center", nullptr, nullptr, -1},
+         {8827045, true, {0x5A, 0x03, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0xD3}, false, nullptr, NAN, NAN, NAN, nullptr, "BOTH", "center", nullptr, nullptr, -1},
+         {15398809, true, {0x5A, 0x15, 0x10, 0x08, 0x00, 0x0D, 0x01, 0x01, 0x30, 0x01, 0x02, 0x00, 0xA1, 0x01, 0x44, 0x00, 0xA4, 0x01, 0x42, 0x6A}, false, nullptr, NAN, NAN, NAN, nullptr, "BOTH", "center", nullptr, nullptr, -1},
+         {15509360, false, {0x5A, 0x15, 0x10, 0x88, 0x00, 0x0B, 0x00, 0x01, 0x30, 0x01, 0x02, 0x00, 0xA1, 0x00, 0x00, 0xA4, 0x00, 0x75}, false, nullptr, NAN, NAN, NAN, nullptr, "BOTH", "center", nullptr, nullptr, -1},
+         {15617310, false, {0x5A, 0x04, 0x10, 0x0A, 0x00, 0x0D, 0x00, 0x01, 0x30, 0x01, 0x02, 0x00, 0xA1, 0x01, 0x44, 0x00, 0xA4, 0x01, 0x42, 0x7A}, true, nullptr, NAN, NAN, NAN, nullptr, "HORIZONTAL", "down", nullptr, nullptr, -1},
+         {15652162, true, {0x5A, 0x04, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0xD2}, false, nullptr, NAN, NAN, NAN, nullptr, "HORIZONTAL", "down", nullptr, nullptr, -1},
+         {28232314, true, {0x5A, 0x16, 0x10, 0x08, 0x00, 0x11, 0x01, 0x01, 0x30, 0x01, 0x03, 0x00, 0xA1, 0x01, 0x42, 0x00, 0xA5, 0x01, 0x43, 0x02, 0x35, 0x01, 0x42, 0xEA}, false, nullptr, NAN, NAN, NAN, nullptr, "HORIZONTAL", "down", nullptr, nullptr, -1},
+         {28336230, false, {0x5A, 0x16, 0x10, 0x88, 0x00, 0x0E, 0x00, 0x01, 0x30, 0x01, 0x03, 0x00, 0xA1, 0x00, 0x00, 0xA5, 0x00, 0x02, 0x35, 0x00, 0x38}, false, nullptr, NAN, NAN, NAN, nullptr, "HORIZONTAL", "down", nullptr, nullptr, -1},
+         {28436043, false, {0x5A, 0x05, 0x10, 0x0A, 0x00, 0x09, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA1, 0x01, 0x42, 0x67}, true, nullptr, NAN, NAN, NAN, nullptr, "OFF", "down", nullptr, nullptr, -1},
+         {28475770, true, {0x5A, 0x05, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0xD1}, false, nullptr, NAN, NAN, NAN, nullptr, "OFF", "down", nullptr, nullptr, -1},
+     }},
+    {"fan_speed_1-5_auto.dsl",
+     {
+         {0, true, {0x5A, 0x66, 0x10, 0x08, 0x00, 0x09, 0x01, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA0, 0x01, 0x32, 0x18}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {67170, false, {0x5A, 0x66, 0x10, 0x88, 0x00, 0x08, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA0, 0x00, 0xCD}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {174110, false, {0x5A, 0x36, 0x10, 0x0A, 0x00, 0x09, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA0, 0x01, 0x32, 0x47}, true, nullptr, NAN, NAN, NAN, "1", nullptr, nullptr, nullptr, nullptr, -1},
+         {213870, true, {0x5A, 0x36, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0xA0}, false, nullptr, NAN, NAN, NAN, "1", nullptr, nullptr, nullptr, nullptr, -1},
+         {5312710, true, {0x5A, 0x67, 0x10, 0x08, 0x00, 0x09, 0x01, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA0, 0x01, 0x33, 0x16}, false, nullptr, NAN, NAN, NAN, "1", nullptr, nullptr, nullptr, nullptr, -1},
+         {5376980, false, {0x5A, 0x67, 0x10, 0x88, 0x00, 0x08, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA0, 0x00, 0xCC}, false, nullptr, NAN, NAN, NAN, "1", nullptr, nullptr, nullptr, nullptr, -1},
+         {5483880, false, {0x5A, 0x37, 0x10, 0x0A, 0x00, 0x09, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA0, 0x01, 0x33, 0x45}, true, nullptr, NAN, NAN, NAN, "2", nullptr, nullptr, nullptr, nullptr, -1},
+         {5526580, true, {0x5A, 0x37, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0x9F}, false, nullptr, NAN, NAN, NAN, "2", nullptr, nullptr, nullptr, nullptr, -1},
+         {10255390, true, {0x5A, 0x68, 0x10, 0x08, 0x00, 0x09, 0x01, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA0, 0x01, 0x34, 0x14}, false, nullptr, NAN, NAN, NAN, "2", nullptr, nullptr, nullptr, nullptr, -1},
+         {10285890, false, {0x5A, 0x68, 0x10, 0x88, 0x00, 0x08, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA0, 0x00, 0xCB}, false, nullptr, NAN, NAN, NAN, "2", nullptr, nullptr, nullptr, nullptr, -1},
+         {10392780, false, {0x5A, 0x38, 0x10, 0x0A, 0x00, 0x09, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA0, 0x01, 0x34, 0x43}, true, nullptr, NAN, NAN, NAN, "3", nullptr, nullptr, nullptr, nullptr, -1},
+         {10438320, true, {0x5A, 0x38, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0x9E}, false, nullptr, NAN, NAN, NAN, "3", nullptr, nullptr, nullptr, nullptr, -1},
+         {14979090, true, {0x5A, 0x69, 0x10, 0x08, 0x00, 0x09, 0x01, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA0, 0x01, 0x35, 0x12}, false, nullptr, NAN, NAN, NAN, "3", nullptr, nullptr, nullptr, nullptr, -1},
+         {15094610, false, {0x5A, 0x69, 0x10, 0x88, 0x00, 0x08, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA0, 0x00, 0xCA}, false, nullptr, NAN, NAN, NAN, "3", nullptr, nullptr, nullptr, nullptr, -1},
+         {15201610, false, {0x5A, 0x39, 0x10, 0x0A, 0x00, 0x09, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA0, 0x01, 0x35, 0x41}, true, nullptr, NAN, NAN, NAN, "4", nullptr, nullptr, nullptr, nullptr, -1},
+         {15252970, true, {0x5A, 0x39, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0x9D}, false, nullptr, NAN, NAN, NAN, "4", nullptr, nullptr, nullptr, nullptr, -1},
+         {19888750, true, {0x5A, 0x6A, 0x10, 0x08, 0x00, 0x09, 0x01, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA0, 0x01, 0x36, 0x10}, false, nullptr, NAN, NAN, NAN, "4", nullptr, nullptr, nullptr, nullptr, -1},
+         {20003340, false, {0x5A, 0x6A, 0x10, 0x88, 0x00, 0x08, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA0, 0x00, 0xC9}, false, nullptr, NAN, NAN, NAN, "4", nullptr, nullptr, nullptr, nullptr, -1},
+         {20110400, false, {0x5A, 0x3A, 0x10, 0x0A, 0x00, 0x09, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA0, 0x01, 0x36, 0x3F}, true, nullptr, NAN, NAN, NAN, "5", nullptr, nullptr, nullptr, nullptr, -1},
+         {20173460, true, {0x5A, 0x3A, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0x9C}, false, nullptr, NAN, NAN, NAN, "5", nullptr, nullptr, nullptr, nullptr, -1},
+         {25205520, true, {0x5A, 0x6B, 0x10, 0x08, 0x00, 0x09, 0x01, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA0, 0x01, 0x41, 0x04}, false, nullptr, NAN, NAN, NAN, "5", nullptr, nullptr, nullptr, nullptr, -1},
+         {25312830, false, {0x5A, 0x6B, 0x10, 0x88, 0x00, 0x08, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA0, 0x00, 0xC8}, false, nullptr, NAN, NAN, NAN, "5", nullptr, nullptr, nullptr, nullptr, -1},
+         {25419600, false, {0x5A, 0x3B, 0x10, 0x0A, 0x00, 0x09, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xA0, 0x01, 0x41, 0x33}, true, nullptr, NAN, NAN, NAN, "Automatic", nullptr, nullptr, nullptr, nullptr, -1},
+         {25439390, true, {0x5A, 0x3B, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0x9B}, false, nullptr, NAN, NAN, NAN, "Automatic", nullptr, nullptr, nullptr, nullptr, -1},
+     }},
+    {"mode_auto_heat_cool_dry.dsl",
+     {
+         {0, true, {0x5A, 0x6F, 0x10, 0x08, 0x00, 0x11, 0x01, 0x01, 0x30, 0x01, 0x03, 0x00, 0xB0, 0x01, 0x41, 0x02, 0x31, 0x01, 0x2E, 0x00, 0xA0, 0x01, 0x41, 0xA2}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {111500, false, {0x5A, 0x6F, 0x10, 0x88, 0x00, 0x0E, 0x00, 0x01, 0x30, 0x01, 0x03, 0x00, 0xB0, 0x00, 0x02, 0x31, 0x00, 0x00, 0xA0, 0x00, 0xD9}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {215860, false, {0x5A, 0x3E, 0x10, 0x0A, 0x00, 0x0D, 0x00, 0x01, 0x30, 0x01, 0x02, 0x00, 0xB0, 0x01, 0x41, 0x02, 0x31, 0x01, 0x2E, 0xB9}, true, nullptr, 23.0f, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {273870, true, {0x5A, 0x3E, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0x98}, false, nullptr, 23.0f, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {7387970, true, {0x5A, 0x70, 0x10, 0x08, 0x00, 0x11, 0x01, 0x01, 0x30, 0x01, 0x03, 0x00, 0xB0, 0x01, 0x43, 0x02, 0x31, 0x01, 0x2C, 0x00, 0xA0, 0x01, 0x41, 0xA1}, false, nullptr, 23.0f, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {7425330, false, {0x5A, 0x70, 0x10, 0x88, 0x00, 0x0E, 0x00, 0x01, 0x30, 0x01, 0x03, 0x00, 0xB0, 0x00, 0x02, 0x31, 0x00, 0x00, 0xA0, 0x00, 0xD8}, false, nullptr, 23.0f, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {7529600, false, {0x5A, 0x3F, 0x10, 0x0A, 0x00, 0x0D, 0x00, 0x01, 0x30, 0x01, 0x02, 0x00, 0xB0, 0x01, 0x43, 0x02, 0x31, 0x01, 0x2C, 0xB8}, true, nullptr, 22.0f, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {7551630, true, {0x5A, 0x3F, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0x97}, false, nullptr, 22.0f, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {13518870, true, {0x5A, 0x71, 0x10, 0x08, 0x00, 0x11, 0x01, 0x01, 0x30, 0x01, 0x03, 0x00, 0xB0, 0x01, 0x42, 0x02, 0x31, 0x01, 0x34, 0x00, 0xA0, 0x01, 0x41, 0x99}, false, nullptr, 22.0f, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {13637090, false, {0x5A, 0x71, 0x10, 0x88, 0x00, 0x0E, 0x00, 0x01, 0x30, 0x01, 0x03, 0x00, 0xB0, 0x00, 0x02, 0x31, 0x00, 0x00, 0xA0, 0x00, 0xD7}, false, nullptr, 22.0f, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {13741210, false, {0x5A, 0x40, 0x10, 0x0A, 0x00, 0x0D, 0x00, 0x01, 0x30, 0x01, 0x02, 0x00, 0xB0, 0x01, 0x42, 0x02, 0x31, 0x01, 0x34, 0xB0}, true, nullptr, 26.0f, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {13782540, true, {0x5A, 0x40, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0x96}, false, nullptr, 26.0f, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {20089810, true, {0x5A, 0x72, 0x10, 0x08, 0x00, 0x11, 0x01, 0x01, 0x30, 0x01, 0x03, 0x00, 0xB0, 0x01, 0x44, 0x02, 0x31, 0x01, 0x32, 0x00, 0xA0, 0x01, 0x41, 0x98}, false, nullptr, 26.0f, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {20149980, false, {0x5A, 0x72, 0x10, 0x88, 0x00, 0x0E, 0x00, 0x01, 0x30, 0x01, 0x03, 0x00, 0xB0, 0x00, 0x02, 0x31, 0x00, 0x00, 0xA0, 0x00, 0xD6}, false, nullptr, 26.0f, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {20254150, false, {0x5A, 0x41, 0x10, 0x0A, 0x00, 0x0D, 0x00, 0x01, 0x30, 0x01, 0x02, 0x00, 0xB0, 0x01, 0x44, 0x02, 0x31, 0x01, 0x32, 0xAF}, true, nullptr, 25.0f, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {20313260, true, {0x5A, 0x41, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0x95}, false, nullptr, 25.0f, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+     }},
+    {"mode_nanoe.dsl",
+     {
+         {0, true, {0x5A, 0x75, 0x10, 0x08, 0x00, 0x1D, 0x01, 0x01, 0x30, 0x01, 0x06, 0x00, 0xB0, 0x01, 0x45, 0x02, 0x31, 0x01, 0x36, 0x00, 0xA0, 0x01, 0x41, 0x00, 0xB2, 0x01, 0x41, 0x02, 0x35, 0x01, 0x42, 0x02, 0x33, 0x01, 0x45, 0x98}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {106450, false, {0x5A, 0x75, 0x10, 0x88, 0x00, 0x17, 0x00, 0x01, 0x30, 0x01, 0x06, 0x00, 0xB0, 0x00, 0x02, 0x31, 0x00, 0x00, 0xA0, 0x00, 0x00, 0xB2, 0x00, 0x02, 0x35, 0x00, 0x02, 0x33, 0x00, 0xA9}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {200070, false, {0x5A, 0x43, 0x10, 0x0A, 0x00, 0x0D, 0x00, 0x01, 0x30, 0x01, 0x02, 0x00, 0xB0, 0x01, 0x45, 0x02, 0x31, 0x01, 0x36, 0xA8}, true, nullptr, 27.0f, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {233560, true, {0x5A, 0x43, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0x93}, false, nullptr, 27.0f, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+     }},
+    {"nanoe_off_on.dsl",
+     {
+         {0, true, {0x5A, 0x6D, 0x10, 0x08, 0x00, 0x09, 0x01, 0x01, 0x30, 0x01, 0x01, 0x02, 0x33, 0x01, 0x42, 0x6C}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {70480, false, {0x5A, 0x6D, 0x10, 0x88, 0x00, 0x08, 0x00, 0x01, 0x30, 0x01, 0x01, 0x02, 0x33, 0x00, 0x31}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {181970, false, {0x5A, 0x3C, 0x10, 0x0A, 0x00, 0x0D, 0x00, 0x01, 0x30, 0x01, 0x02, 0x02, 0x20, 0x01, 0x42, 0x02, 0x33, 0x01, 0x42, 0x32}, true, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, 0},
+         {203140, true, {0x5A, 0x3C, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0x9A}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, 0},
+         {6321950, true, {0x5A, 0x6E, 0x10, 0x08, 0x00, 0x09, 0x01, 0x01, 0x30, 0x01, 0x01, 0x02, 0x33, 0x01, 0x45, 0x68}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, 0},
+         {6382440, false, {0x5A, 0x6E, 0x10, 0x88, 0x00, 0x08, 0x00, 0x01, 0x30, 0x01, 0x01, 0x02, 0x33, 0x00, 0x30}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, 0},
+         {6493870, false, {0x5A, 0x3D, 0x10, 0x0A, 0x00, 0x0D, 0x00, 0x01, 0x30, 0x01, 0x02, 0x02, 0x20, 0x01, 0x43, 0x02, 0x33, 0x01, 0x43, 0x2F}, true, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, 1},
+         {6516970, true, {0x5A, 0x3D, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0x99}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, 1},
+     }},
+    {"on_off.dsl",
+     {
+         {0, true, {0x5A, 0x24, 0x10, 0x08, 0x00, 0x0D, 0x01, 0x01, 0x30, 0x01, 0x02, 0x00, 0x80, 0x01, 0x30, 0x00, 0xB0, 0x01, 0x42, 0x84}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {113160, false, {0x5A, 0x24, 0x10, 0x88, 0x00, 0x0B, 0x00, 0x01, 0x30, 0x01, 0x02, 0x00, 0x80, 0x00, 0x00, 0xB0, 0x00, 0x7B}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {216310, false, {0x5A, 0xA6, 0x10, 0x0A, 0x00, 0x09, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0x80, 0x01, 0x30, 0xF9}, true, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {263660, true, {0x5A, 0xA6, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0x30}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {14093930, true, {0x5A, 0x25, 0x10, 0x08, 0x00, 0x0D, 0x01, 0x01, 0x30, 0x01, 0x02, 0x00, 0x80, 0x01, 0x31, 0x00, 0xB0, 0x01, 0x42, 0x82}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {14137190, false, {0x5A, 0x25, 0x10, 0x88, 0x00, 0x0B, 0x00, 0x01, 0x30, 0x01, 0x02, 0x00, 0x80, 0x00, 0x00, 0xB0, 0x00, 0x7A}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {14239760, false, {0x5A, 0xA7, 0x10, 0x0A, 0x00, 0x09, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0x80, 0x01, 0x31, 0xF7}, true, "OFF", NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {14287180, true, {0x5A, 0xA7, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0x2F}, false, "OFF", NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {27429370, true, {0x5A, 0x26, 0x10, 0x09, 0x00, 0x38, 0x01, 0x01, 0x30, 0x01, 0x11, 0x00, 0x80, 0x00, 0x00, 0xB0, 0x00, 0x02, 0x31, 0x00, 0x00, 0xA0, 0x00, 0x00, 0xA1, 0x00, 0x00, 0xA5, 0x00, 0x00, 0xA4, 0x00, 0x00, 0xB2, 0x00, 0x02, 0x35, 0x00, 0x02, 0x33, 0x00, 0x02, 0x34, 0x00, 0x02, 0x32, 0x00, 0x00, 0xBB, 0x00, 0x00, 0xBE, 0x00, 0x02, 0x20, 0x00, 0x02, 0x21, 0x00, 0x00, 0x86, 0x00, 0x32}, false, "OFF", NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {27585380, false, {0x5A, 0x26, 0x10, 0x89, 0x00, 0x76, 0x00, 0x01, 0x30, 0x01, 0x11, 0x00, 0x80, 0x01, 0x31, 0x00, 0xB0, 0x01, 0x42, 0x02, 0x31, 0x01, 0x30, 0x00, 0xA0, 0x01, 0x41, 0x00, 0xA1, 0x01, 0x42, 0x00, 0xA5, 0x01, 0x42, 0x00, 0xA4, 0x01, 0x42, 0x00, 0xB2, 0x01, 0x41, 0x02, 0x35, 0x01, 0x41, 0x02, 0x33, 0x01, 0x43, 0x02, 0x34, 0x01, 0x41, 0x02, 0x32, 0x01, 0x41, 0x00, 0xBB, 0x01, 0x16, 0x00, 0xBE, 0x01, 0x0F, 0x02, 0x20, 0x01, 0x42, 0x02, 0x21, 0x01, 0x41, 0x00, 0x86, 0x2E, 0x2A, 0x00, 0x00, 0x0B, 0x01, 0x01, 0x48, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F}, true, "OFF", 24.0f, 22.0f, 15.0f, "Automatic", "OFF", "down", "left", "Normal", 1},
+     }},
+    {"query_20_15_degress.dsl",
+     {
+         {0, true, {0x5A, 0x78, 0x10, 0x09, 0x00, 0x38, 0x01, 0x01, 0x30, 0x01, 0x11, 0x00, 0x80, 0x00, 0x00, 0xB0, 0x00, 0x02, 0x31, 0x00, 0x00, 0xA0, 0x00, 0x00, 0xA1, 0x00, 0x00, 0xA5, 0x00, 0x00, 0xA4, 0x00, 0x00, 0xB2, 0x00, 0x02, 0x35, 0x00, 0x02, 0x33, 0x00, 0x02, 0x34, 0x00, 0x02, 0x32, 0x00, 0x00, 0xBB, 0x00, 0x00, 0xBE, 0x00, 0x02, 0x20, 0x00, 0x02, 0x21, 0x00, 0x00, 0x86, 0x00, 0xE0}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {228680, false, {0x5A, 0x78, 0x10, 0x89, 0x00, 0x76, 0x00, 0x01, 0x30, 0x01, 0x11, 0x00, 0x80, 0x01, 0x30, 0x00, 0xB0, 0x01, 0x42, 0x02, 0x31, 0x01, 0x34, 0x00, 0xA0, 0x01, 0x41, 0x00, 0xA1, 0x01, 0x42, 0x00, 0xA5, 0x01, 0x42, 0x00, 0xA4, 0x01, 0x42, 0x00, 0xB2, 0x01, 0x41, 0x02, 0x35, 0x01, 0x41, 0x02, 0x33, 0x01, 0x43, 0x02, 0x34, 0x01, 0x41, 0x02, 0x32, 0x01, 0x41, 0x00, 0xBB, 0x01, 0x14, 0x00, 0xBE, 0x01, 0x0F, 0x02, 0x20, 0x01, 0x43, 0x02, 0x21, 0x01, 0x41, 0x00, 0x86, 0x2E, 0x2A, 0x00, 0x00, 0x0B, 0x01, 0x01, 0x48, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B}, true, "COOL", 26.0f, 20.0f, 15.0f, "Automatic", "OFF", "down", "left", "Normal", 1},
+         {2093390, true, {0x5A, 0x79, 0x10, 0x09, 0x00, 0x38, 0x01, 0x01, 0x30, 0x01, 0x11, 0x00, 0x80, 0x00, 0x00, 0xB0, 0x00, 0x02, 0x31, 0x00, 0x00, 0xA0, 0x00, 0x00, 0xA1, 0x00, 0x00, 0xA5, 0x00, 0x00, 0xA4, 0x00, 0x00, 0xB2, 0x00, 0x02, 0x35, 0x00, 0x02, 0x33, 0x00, 0x02, 0x34, 0x00, 0x02, 0x32, 0x00, 0x00, 0xBB, 0x00, 0x00, 0xBE, 0x00, 0x02, 0x20, 0x00, 0x02, 0x21, 0x00, 0x00, 0x86, 0x00, 0xDF}, false, "COOL", 26.0f, 20.0f, 15.0f, "Automatic", "OFF", "down", "left", "Normal", 1},
+         {2332500, false, {0x5A, 0x79, 0x10, 0x89, 0x00, 0x76, 0x00, 0x01, 0x30, 0x01, 0x11, 0x00, 0x80, 0x01, 0x30, 0x00, 0xB0, 0x01, 0x42, 0x02, 0x31, 0x01, 0x34, 0x00, 0xA0, 0x01, 0x41, 0x00, 0xA1, 0x01, 0x42, 0x00, 0xA5, 0x01, 0x42, 0x00, 0xA4, 0x01, 0x42, 0x00, 0xB2, 0x01, 0x41, 0x02, 0x35, 0x01, 0x41, 0x02, 0x33, 0x01, 0x43, 0x02, 0x34, 0x01, 0x41, 0x02, 0x32, 0x01, 0x41, 0x00, 0xBB, 0x01, 0x14, 0x00, 0xBE, 0x01, 0x0F, 0x02, 0x20, 0x01, 0x43, 0x02, 0x21, 0x01, 0x41, 0x00, 0x86, 0x2E, 0x2A, 0x00, 0x00, 0x0B, 0x01, 0x01, 0x48, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A}, true, "COOL", 26.0f, 20.0f, 15.0f, "Automatic", "OFF", "down", "left", "Normal", 1},
+     }},
+    {"quiet_on_off_powerful_on_off.dsl",
+     {
+         {0, true, {0x5A, 0x42, 0x10, 0x08, 0x00, 0x15, 0x01, 0x01, 0x30, 0x01, 0x04, 0x00, 0xB0, 0x01, 0x42, 0x00, 0xB2, 0x01, 0x43, 0x02, 0x35, 0x01, 0x42, 0x02, 0x34, 0x01, 0x42, 0x24}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {88600, false, {0x5A, 0x42, 0x10, 0x88, 0x00, 0x11, 0x00, 0x01, 0x30, 0x01, 0x04, 0x00, 0xB0, 0x00, 0x00, 0xB2, 0x00, 0x02, 0x35, 0x00, 0x02, 0x34, 0x00, 0xB6}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {185140, false, {0x5A, 0x19, 0x10, 0x0A, 0x00, 0x09, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xB2, 0x01, 0x43, 0x41}, true, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, "Quiet", -1},
+         {213770, true, {0x5A, 0x19, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0xBD}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, "Quiet", -1},
+         {7288600, true, {0x5A, 0x43, 0x10, 0x08, 0x00, 0x0D, 0x01, 0x01, 0x30, 0x01, 0x02, 0x00, 0xB0, 0x01, 0x42, 0x00, 0xB2, 0x01, 0x41, 0x22}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, "Quiet", -1},
+         {7395140, false, {0x5A, 0x43, 0x10, 0x88, 0x00, 0x0B, 0x00, 0x01, 0x30, 0x01, 0x02, 0x00, 0xB0, 0x00, 0x00, 0xB2, 0x00, 0x2A}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, "Quiet", -1},
+         {7498360, false, {0x5A, 0x1A, 0x10, 0x0A, 0x00, 0x09, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xB2, 0x01, 0x41, 0x42}, true, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, "Normal", -1},
+         {7531740, true, {0x5A, 0x1A, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0xBC}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, "Normal", -1},
+         {14940150, true, {0x5A, 0x44, 0x10, 0x08, 0x00, 0x15, 0x01, 0x01, 0x30, 0x01, 0x04, 0x00, 0xB0, 0x01, 0x42, 0x00, 0xB2, 0x01, 0x42, 0x02, 0x35, 0x01, 0x42, 0x02, 0x34, 0x01, 0x42, 0x23}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, "Normal", -1},
+         {15016380, false, {0x5A, 0x44, 0x10, 0x88, 0x00, 0x11, 0x00, 0x01, 0x30, 0x01, 0x04, 0x00, 0xB0, 0x00, 0x00, 0xB2, 0x00, 0x02, 0x35, 0x00, 0x02, 0x34, 0x00, 0xB4}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, "Normal", -1},
+         {15112800, false, {0x5A, 0x1B, 0x10, 0x0A, 0x00, 0x09, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xB2, 0x01, 0x42, 0x40}, true, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, "Powerful", -1},
+         {15153810, true, {0x5A, 0x1B, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0xBB}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, "Powerful", -1},
+         {21579630, true, {0x5A, 0x45, 0x10, 0x08, 0x00, 0x0D, 0x01, 0x01, 0x30, 0x01, 0x02, 0x00, 0xB0, 0x01, 0x42, 0x00, 0xB2, 0x01, 0x41, 0x20}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, "Powerful", -1},
+         {21621940, false, {0x5A, 0x45, 0x10, 0x88, 0x00, 0x0B, 0x00, 0x01, 0x30, 0x01, 0x02, 0x00, 0xB0, 0x00, 0x00, 0xB2, 0x00, 0x28}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, "Powerful", -1},
+         {21725290, false, {0x5A, 0x1C, 0x10, 0x0A, 0x00, 0x09, 0x00, 0x01, 0x30, 0x01, 0x01, 0x00, 0xB2, 0x01, 0x41, 0x40}, true, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, "Normal", -1},
+         {21772770, true, {0x5A, 0x1C, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0xBA}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, "Normal", -1},
+     }},
+    {"temperature_24.5-26.dsl",
+     {
+         {0, true, {0x5A, 0x2C, 0x10, 0x08, 0x00, 0x0D, 0x01, 0x01, 0x30, 0x01, 0x02, 0x00, 0xB0, 0x01, 0x42, 0x02, 0x31, 0x01, 0x31, 0xC8}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {102640, false, {0x5A, 0x2C, 0x10, 0x88, 0x00, 0x0B, 0x00, 0x01, 0x30, 0x01, 0x02, 0x00, 0xB0, 0x00, 0x02, 0x31, 0x00, 0xC0}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {7344020, true, {0x5A, 0x2D, 0x10, 0x08, 0x00, 0x0D, 0x01, 0x01, 0x30, 0x01, 0x02, 0x00, 0xB0, 0x01, 0x42, 0x02, 0x31, 0x01, 0x32, 0xC6}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {7415650, false, {0x5A, 0x2D, 0x10, 0x88, 0x00, 0x0B, 0x00, 0x01, 0x30, 0x01, 0x02, 0x00, 0xB0, 0x00, 0x02, 0x31, 0x00, 0xBF}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {7518870, false, {0x5A, 0xAD, 0x10, 0x0A, 0x00, 0x09, 0x00, 0x01, 0x30, 0x01, 0x01, 0x02, 0x31, 0x01, 0x32, 0x3D}, true, nullptr, 25.0f, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {7557170, true, {0x5A, 0xAD, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0x29}, false, nullptr, 25.0f, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {18255520, true, {0x5A, 0x2E, 0x10, 0x08, 0x00, 0x0D, 0x01, 0x01, 0x30, 0x01, 0x02, 0x00, 0xB0, 0x01, 0x42, 0x02, 0x31, 0x01, 0x33, 0xC4}, false, nullptr, 25.0f, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {18334770, false, {0x5A, 0x2E, 0x10, 0x88, 0x00, 0x0B, 0x00, 0x01, 0x30, 0x01, 0x02, 0x00, 0xB0, 0x00, 0x02, 0x31, 0x00, 0xBE}, false, nullptr, 25.0f, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {18437990, false, {0x5A, 0xAE, 0x10, 0x0A, 0x00, 0x09, 0x00, 0x01, 0x30, 0x01, 0x01, 0x02, 0x31, 0x01, 0x33, 0x3B}, true, nullptr, 25.5f, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {18478660, true, {0x5A, 0xAE, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0x28}, false, nullptr, 25.5f, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {27909930, true, {0x5A, 0x2F, 0x10, 0x08, 0x00, 0x0D, 0x01, 0x01, 0x30, 0x01, 0x02, 0x00, 0xB0, 0x01, 0x42, 0x02, 0x31, 0x01, 0x34, 0xC2}, false, nullptr, 25.5f, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {27951670, false, {0x5A, 0x2F, 0x10, 0x88, 0x00, 0x0B, 0x00, 0x01, 0x30, 0x01, 0x02, 0x00, 0xB0, 0x00, 0x02, 0x31, 0x00, 0xBD}, false, nullptr, 25.5f, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {28054890, false, {0x5A, 0xAF, 0x10, 0x0A, 0x00, 0x09, 0x00, 0x01, 0x30, 0x01, 0x01, 0x02, 0x31, 0x01, 0x34, 0x39}, true, nullptr, 26.0f, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {28103070, true, {0x5A, 0xAF, 0x10, 0x8A, 0x00, 0x04, 0x00, 0x01, 0x30, 0x01, 0x27}, false, nullptr, 26.0f, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+     }},
+    {"wakeup1.dsl",
+     {
+         {0, true, {0x5A, 0x18, 0x10, 0x09, 0x00, 0x38, 0x01, 0x01, 0x30, 0x01, 0x11, 0x00, 0x80, 0x00, 0x00, 0xB0, 0x00, 0x02, 0x31, 0x00, 0x00, 0xA0, 0x00, 0x00, 0xA1, 0x00, 0x00, 0xA5, 0x00, 0x00, 0xA4, 0x00, 0x00, 0xB2, 0x00, 0x02, 0x35, 0x00, 0x02, 0x33, 0x00, 0x02, 0x34, 0x00, 0x02, 0x32, 0x00, 0x00, 0xBB, 0x00, 0x00, 0xBE, 0x00, 0x02, 0x20, 0x00, 0x02, 0x21, 0x00, 0x00, 0x86, 0x00, 0x40}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {203980, false, {0x5A, 0x18, 0x10, 0x89, 0x00, 0x76, 0x00, 0x01, 0x30, 0x01, 0x11, 0x00, 0x80, 0x01, 0x31, 0x00, 0xB0, 0x01, 0x42, 0x02, 0x31, 0x01, 0x2F, 0x00, 0xA0, 0x01, 0x41, 0x00, 0xA1, 0x01, 0x42, 0x00, 0xA5, 0x01, 0x42, 0x00, 0xA4, 0x01, 0x42, 0x00, 0xB2, 0x01, 0x41, 0x02, 0x35, 0x01, 0x41, 0x02, 0x33, 0x01, 0x43, 0x02, 0x34, 0x01, 0x41, 0x02, 0x32, 0x01, 0x41, 0x00, 0xBB, 0x01, 0x16, 0x00, 0xBE, 0x01, 0x16, 0x02, 0x20, 0x01, 0x42, 0x02, 0x21, 0x01, 0x41, 0x00, 0x86, 0x2E, 0x2A, 0x00, 0x00, 0x0B, 0x01, 0x01, 0x48, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97}, true, "OFF", 23.5f, 22.0f, 22.0f, "Automatic", "OFF", "down", "left", "Normal", 1},
+     }},
+    {"wakeup2.dsl",
+     {
+         {0, true, {0x5A, 0x1D, 0x10, 0x09, 0x00, 0x38, 0x01, 0x01, 0x30, 0x01, 0x11, 0x00, 0x80, 0x00, 0x00, 0xB0, 0x00, 0x02, 0x31, 0x00, 0x00, 0xA0, 0x00, 0x00, 0xA1, 0x00, 0x00, 0xA5, 0x00, 0x00, 0xA4, 0x00, 0x00, 0xB2, 0x00, 0x02, 0x35, 0x00, 0x02, 0x33, 0x00, 0x02, 0x34, 0x00, 0x02, 0x32, 0x00, 0x00, 0xBB, 0x00, 0x00, 0xBE, 0x00, 0x02, 0x20, 0x00, 0x02, 0x21, 0x00, 0x00, 0x86, 0x00, 0x3B}, false, nullptr, NAN, NAN, NAN, nullptr, nullptr, nullptr, nullptr, nullptr, -1},
+         {153600, false, {0x5A, 0x1D, 0x10, 0x89, 0x00, 0x76, 0x00, 0x01, 0x30, 0x01, 0x11, 0x00, 0x80, 0x01, 0x31, 0x00, 0xB0, 0x01, 0x42, 0x02, 0x31, 0x01, 0x2F, 0x00, 0xA0, 0x01, 0x41, 0x00, 0xA1, 0x01, 0x42, 0x00, 0xA5, 0x01, 0x42, 0x00, 0xA4, 0x01, 0x42, 0x00, 0xB2, 0x01, 0x41, 0x02, 0x35, 0x01, 0x41, 0x02, 0x33, 0x01, 0x43, 0x02, 0x34, 0x01, 0x41, 0x02, 0x32, 0x01, 0x41, 0x00, 0xBB, 0x01, 0x16, 0x00, 0xBE, 0x01, 0x16, 0x02, 0x20, 0x01, 0x42, 0x02, 0x21, 0x01, 0x41, 0x00, 0x86, 0x2E, 0x2A, 0x00, 0x00, 0x0B, 0x01, 0x01, 0x48, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92}, true, "OFF", 23.5f, 22.0f, 22.0f, "Automatic", "OFF", "down", "left", "Normal", 1},
+         {3698520, true, {0x5A, 0x1E, 0x10, 0x09, 0x00, 0x38, 0x01, 0x01, 0x30, 0x01, 0x11, 0x00, 0x80, 0x00, 0x00, 0xB0, 0x00, 0x02, 0x31, 0x00, 0x00, 0xA0, 0x00, 0x00, 0xA1, 0x00, 0x00, 0xA5, 0x00, 0x00, 0xA4, 0x00, 0x00, 0xB2, 0x00, 0x02, 0x35, 0x00, 0x02, 0x33, 0x00, 0x02, 0x34, 0x00, 0x02, 0x32, 0x00, 0x00, 0xBB, 0x00, 0x00, 0xBE, 0x00, 0x02, 0x20, 0x00, 0x02, 0x21, 0x00, 0x00, 0x86, 0x00, 0x3A}, false, "OFF", 23.5f, 22.0f, 22.0f, "Automatic", "OFF", "down", "left", "Normal", 1},
+         {3860320, false, {0x5A, 0x1E, 0x10, 0x89, 0x00, 0x76, 0x00, 0x01, 0x30, 0x01, 0x11, 0x00, 0x80, 0x01, 0x31, 0x00, 0xB0, 0x01, 0x42, 0x02, 0x31, 0x01, 0x2F, 0x00, 0xA0, 0x01, 0x41, 0x00, 0xA1, 0x01, 0x42, 0x00, 0xA5, 0x01, 0x42, 0x00, 0xA4, 0x01, 0x42, 0x00, 0xB2, 0x01, 0x41, 0x02, 0x35, 0x01, 0x41, 0x02, 0x33, 0x01, 0x43, 0x02, 0x34, 0x01, 0x41, 0x02, 0x32, 0x01, 0x41, 0x00, 0xBB, 0x01, 0x16, 0x00, 0xBE, 0x01, 0x16, 0x02, 0x20, 0x01, 0x42, 0x02, 0x21, 0x01, 0x41, 0x00, 0x86, 0x2E, 0x2A, 0x00, 0x00, 0x0B, 0x01, 0x01, 0x48, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91}, true, "OFF", 23.5f, 22.0f, 22.0f, "Automatic", "OFF", "down", "left", "Normal", 1},
+         {6425820, true, {0x5A, 0x1F, 0x10, 0x09, 0x00, 0x38, 0x01, 0x01, 0x30, 0x01, 0x11, 0x00, 0x80, 0x00, 0x00, 0xB0, 0x00, 0x02, 0x31, 0x00, 0x00, 0xA0, 0x00, 0x00, 0xA1, 0x00, 0x00, 0xA5, 0x00, 0x00, 0xA4, 0x00, 0x00, 0xB2, 0x00, 0x02, 0x35, 0x00, 0x02, 0x33, 0x00, 0x02, 0x34, 0x00, 0x02, 0x32, 0x00, 0x00, 0xBB, 0x00, 0x00, 0xBE, 0x00, 0x02, 0x20, 0x00, 0x02, 0x21, 0x00, 0x00, 0x86, 0x00, 0x39}, false, "OFF", 23.5f, 22.0f, 22.0f, "Automatic", "OFF", "down", "left", "Normal", 1},
+         {6665150, false, {0x5A, 0x1F, 0x10, 0x89, 0x00, 0x76, 0x00, 0x01, 0x30, 0x01, 0x11, 0x00, 0x80, 0x01, 0x31, 0x00, 0xB0, 0x01, 0x42, 0x02, 0x31, 0x01, 0x2F, 0x00, 0xA0, 0x01, 0x41, 0x00, 0xA1, 0x01, 0x42, 0x00, 0xA5, 0x01, 0x42, 0x00, 0xA4, 0x01, 0x42, 0x00, 0xB2, 0x01, 0x41, 0x02, 0x35, 0x01, 0x41, 0x02, 0x33, 0x01, 0x43, 0x02, 0x34, 0x01, 0x41, 0x02, 0x32, 0x01, 0x41, 0x00, 0xBB, 0x01, 0x16, 0x00, 0xBE, 0x01, 0x16, 0x02, 0x20, 0x01, 0x42, 0x02, 0x21, 0x01, 0x41, 0x00, 0x86, 0x2E, 0x2A, 0x00, 0x00, 0x0B, 0x01, 0x01, 0x48, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90}, true, "OFF", 23.5f, 22.0f, 22.0f, "Automatic", "OFF", "down", "left", "Normal", 1},
+         {9065300, true, {0x5A, 0x20, 0x10, 0x09, 0x00, 0x38, 0x01, 0x01, 0x30, 0x01, 0x11, 0x00, 0x80, 0x00, 0x00, 0xB0, 0x00, 0x02, 0x31, 0x00, 0x00, 0xA0, 0x00, 0x00, 0xA1, 0x00, 0x00, 0xA5, 0x00, 0x00, 0xA4, 0x00, 0x00, 0xB2, 0x00, 0x02, 0x35, 0x00, 0x02, 0x33, 0x00, 0x02, 0x34, 0x00, 0x02, 0x32, 0x00, 0x00, 0xBB, 0x00, 0x00, 0xBE, 0x00, 0x02, 0x20, 0x00, 0x02, 0x21, 0x00, 0x00, 0x86, 0x00, 0x38}, false, "OFF", 23.5f, 22.0f, 22.0f, "Automatic", "OFF", "down", "left", "Normal", 1},
+         {9269540, false, {0x5A, 0x20, 0x10, 0x89, 0x00, 0x76, 0x00, 0x01, 0x30, 0x01, 0x11, 0x00, 0x80, 0x01, 0x31, 0x00, 0xB0, 0x01, 0x42, 0x02, 0x31, 0x01, 0x2F, 0x00, 0xA0, 0x01, 0x41, 0x00, 0xA1, 0x01, 0x42, 0x00, 0xA5, 0x01, 0x42, 0x00, 0xA4, 0x01, 0x42, 0x00, 0xB2, 0x01, 0x41, 0x02, 0x35, 0x01, 0x41, 0x02, 0x33, 0x01, 0x43, 0x02, 0x34, 0x01, 0x41, 0x02, 0x32, 0x01, 0x41, 0x00, 0xBB, 0x01, 0x16, 0x00, 0xBE, 0x01, 0x16, 0x02, 0x20, 0x01, 0x42, 0x02, 0x21, 0x01, 0x41, 0x00, 0x86, 0x2E, 0x2A, 0x00, 0x00, 0x0B, 0x01, 0x01, 0x48, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F}, true, "OFF", 23.5f, 22.0f, 22.0f, "Automatic", "OFF", "down", "left", "Normal", 1},
+     }},
+};
+
+}  // namespace vectors
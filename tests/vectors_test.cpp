@@ -0,0 +1,203 @@
+/*
+ * Host test of both drivers against the golden vectors of tests/vectors/, generated by tools/generate_vectors.py
+ *
+ * Built by the host build in CMakeLists.txt and run by ctest. Every CN-CNT vector is the answer to the first poll of a
+ * fresh driver, which must send the documented poll request and decode the state of the vector. The CN-WLAN captures
+ * are fed to a driver in passive mode at their recorded times, after every query response and report of the AC the
+ * state of the driver must match the state the AC reported so far.
+ *
+ *   vectors_test [-v]
+ *
+ * -v prints the log of the drivers at DEBUG level.
+ */
+
+#include "vectors/cnt_vectors.h"
+#include "vectors/wlan_vectors.h"
+
+#include "esppac_cnt.h"
+#include "esppac_wlan.h"
+#include "panasonic_ac_select.h"
+#include "panasonic_ac_switch.h"
+
+#include "host.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+using namespace esphome;
+using namespace esphome::panasonic_ac;
+
+static int failures = 0;
+static const char *current = "";  // Vector or capture frame being checked, printed with failures
+
+#define CHECK(condition) \
+  do { \
+    if (!(condition)) { \
+      fprintf(stderr, "%s:%d: %s: check failed: %s\n", __FILE__, __LINE__, current, #condition); \
+      failures++; \
+    } \
+  } while (0)
+
+static bool verbose = false;
+
+/*
+ * Entities of the driver, the switches and selects the drivers publish to
+ */
+struct Entities {
+  PanasonicACSelect vertical_swing, horizontal_swing;
+  PanasonicACSwitch nanoex, eco, econavi, mild_dry;
+
+  Entities() {
+    vertical_swing.traits.set_options({"swing", "auto", "up", "up_center", "center", "down_center", "down"});
+    horizontal_swing.traits.set_options({"auto", "left", "left_center", "center", "right_center", "right"});
+  }
+
+  template<typename Driver> void attach(Driver &driver) {
+    driver.set_vertical_swing_select(&this->vertical_swing);
+    driver.set_horizontal_swing_select(&this->horizontal_swing);
+    driver.set_nanoex_switch(&this->nanoex);
+  }
+};
+
+// Runs the loop at every deadline of the driver up to time, time never goes backwards
+static void run_until(PanasonicAC &driver, uint64_t time) {
+  while (true) {
+    uint32_t wait = driver.get_time_to_next_deadline();
+    uint64_t deadline = host::time_us() + (uint64_t) wait * 1000;
+
+    if (wait == UINT32_MAX || deadline > time)
+      break;
+
+    host::set_time_us(deadline);
+    driver.loop();
+  }
+
+  host::set_time_us(std::max(time, host::time_us()));
+  driver.loop();
+}
+
+static bool equal(float a, float b) { return (std::isnan(a) && std::isnan(b)) || a == b; }
+
+static void test_cnt_vector(const vectors::CNTVector &vector) {
+  current = vector.name;
+  host::set_time_us(1000000);
+
+  uart::FifoUART uart;
+  Entities entities;
+  CNT::PanasonicACCNT driver;
+  driver.set_uart_parent(&uart);
+  entities.attach(driver);
+  driver.set_eco_switch(&entities.eco);
+  driver.set_econavi_switch(&entities.econavi);
+  driver.set_mild_dry_switch(&entities.mild_dry);
+
+  size_t polls = 0;
+  uart.set_write_callback([&](const uint8_t *data, size_t length) {
+    if (std::vector<uint8_t>(data, data + length) != vectors::CNT_QUERY_REQUEST)
+      return;
+
+    if (polls++ == 0)
+      uart.receive(vector.frame);
+  });
+
+  driver.setup();
+  for (int i = 0; i < 100 && polls == 0; i++)
+    run_until(driver, host::time_us() + CNT::POLL_INTERVAL * 1000);
+  run_until(driver, host::time_us() + 1000000);  // The answer of the first poll is decoded
+
+  CHECK(polls > 0);
+  CHECK(strcmp(climate::climate_mode_to_string(driver.mode), vector.mode) == 0);
+  CHECK(equal(driver.target_temperature, vector.target_temperature));
+  CHECK(equal(driver.current_temperature, vector.current_temperature));
+  CHECK(driver.get_custom_fan_mode() == vector.fan_mode);
+  CHECK(strcmp(climate::climate_swing_mode_to_string(driver.swing_mode), vector.swing_mode) == 0);
+  CHECK(entities.vertical_swing.current_option() == vector.vertical_swing);
+  CHECK(entities.horizontal_swing.current_option() == vector.horizontal_swing);
+  CHECK(driver.get_custom_preset() == vector.preset);
+  CHECK(entities.nanoex.state == vector.nanoex);
+  CHECK(entities.econavi.state == vector.econavi);
+  CHECK(entities.mild_dry.state == vector.mild_dry);
+  CHECK(entities.eco.state == vector.eco);
+}
+
+static void check_wlan_state(const WLAN::PanasonicACWLAN &driver, const Entities &entities,
+                             const vectors::WLANFrame &frame, sensor::Sensor &outside_temperature) {
+  if (frame.mode != nullptr)
+    CHECK(strcmp(climate::climate_mode_to_string(driver.mode), frame.mode) == 0);
+  if (!std::isnan(frame.target_temperature))
+    CHECK(driver.target_temperature == frame.target_temperature);
+  if (!std::isnan(frame.current_temperature))
+    CHECK(driver.current_temperature == frame.current_temperature);
+  if (!std::isnan(frame.outside_temperature))
+    CHECK(outside_temperature.state == frame.outside_temperature);
+  if (frame.fan_mode != nullptr)
+    CHECK(driver.get_custom_fan_mode() == frame.fan_mode);
+  if (frame.swing_mode != nullptr)
+    CHECK(strcmp(climate::climate_swing_mode_to_string(driver.swing_mode), frame.swing_mode) == 0);
+  if (frame.vertical_swing != nullptr)
+    CHECK(entities.vertical_swing.current_option() == frame.vertical_swing);
+  if (frame.horizontal_swing != nullptr)
+    CHECK(entities.horizontal_swing.current_option() == frame.horizontal_swing);
+  if (frame.preset != nullptr)
+    CHECK(driver.get_custom_preset() == frame.preset);
+  if (frame.nanoex >= 0)
+    CHECK(entities.nanoex.state == (frame.nanoex == 1));
+}
+
+static size_t test_wlan_capture(const vectors::WLANCapture &capture) {
+  static const uint64_t START_US = 1000000;
+
+  host::set_time_us(0);
+
+  uart::FifoUART ac_side, controller_side;
+  Entities entities;
+  sensor::Sensor outside_temperature;
+  WLAN::PanasonicACWLAN driver;
+  driver.set_uart_parent(&ac_side);
+  driver.set_passive(true);
+  driver.set_controller_uart(&controller_side);
+  entities.attach(driver);
+  driver.set_outside_temperature_sensor(&outside_temperature);
+  driver.setup();
+
+  size_t checked = 0;
+  std::string name;
+
+  for (const vectors::WLANFrame &frame : capture.frames) {
+    run_until(driver, START_US + frame.time);
+    (frame.outgoing ? controller_side : ac_side).receive(frame.data);
+    driver.loop();
+
+    if (!frame.checked)
+      continue;
+
+    run_until(driver, host::time_us() + (READ_TIMEOUT + 5) * 1000);
+
+    name = std::string(capture.name) + " at " + std::to_string(frame.time / 1000) + " ms";
+    current = name.c_str();
+    check_wlan_state(driver, entities, frame, outside_temperature);
+    checked++;
+  }
+
+  return checked;
+}
+
+int main(int argc, char **argv) {
+  verbose = argc > 1 && strcmp(argv[1], "-v") == 0;
+  host::set_log_level(verbose ? ESPHOME_LOG_LEVEL_DEBUG : ESPHOME_LOG_LEVEL_NONE);
+
+  for (const vectors::CNTVector &vector : vectors::CNT_VECTORS)
+    test_cnt_vector(vector);
+
+  size_t checked = 0;
+  for (const vectors::WLANCapture &capture : vectors::WLAN_CAPTURES)
+    checked += test_wlan_capture(capture);
+
+  printf("%zu CN-CNT vectors, %zu CN-WLAN frames of %zu captures checked\n",
+         sizeof(vectors::CNT_VECTORS) / sizeof(vectors::CNT_VECTORS[0]), checked,
+         sizeof(vectors::WLAN_CAPTURES) / sizeof(vectors::WLAN_CAPTURES[0]));
+
+  return failures == 0 ? 0 : 1;
+}
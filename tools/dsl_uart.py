@@ -0,0 +1,169 @@
+#!/usr/bin/env python3
+"""Decode the CN-WLAN traffic in the DSView logic analyzer captures under protocol/logic_analyzer/.
+
+A .dsl file is a zip archive. Its header names the probes (RX is the line from the AC to the adapter, TX the line from
+the adapter to the AC) and gives the sample rate. The samples of every probe are bit-packed, least significant bit
+first, in numbered blocks L-<probe>/<block>. The UART runs at 9600 baud, 8E1, idle high.
+
+    dsl_uart.py frames <capture.dsl>...            Print the frames of each capture with their time and direction
+    dsl_uart.py flight-recorder <capture.dsl>      Print the frames as flight recorder dump lines, see esppac.cpp
+    dsl_uart.py corpus <dir> <capture.dsl>...      Write every distinct valid frame to a file in dir, e.g. as fuzzing seeds
+"""
+
+import base64
+import hashlib
+import os
+import re
+import sys
+import zipfile
+
+BAUD = 9600
+FRAME_GAP = 0.02  # Same as READ_TIMEOUT, a longer pause ends a frame
+
+NOT_IDLE = re.compile(rb"[^\xff]")
+UNITS = {"Hz": 1, "kHz": 1e3, "MHz": 1e6}
+
+
+def read_capture(path):
+    """Returns the sample rate and a dict of probe name to the packed samples of that probe."""
+    archive = zipfile.ZipFile(path)
+    header = {}
+    for line in archive.read("header").decode().splitlines():
+        if "=" in line:
+            key, value = line.split("=", 1)
+            header[key.strip()] = value.strip()
+
+    value, unit = header["samplerate"].split()
+    rate = float(value) * UNITS[unit]
+
+    probes = {}
+    for key, name in header.items():
+        if not key.startswith("probe"):
+            continue
+        prefix = "L-%d/" % int(key[5:])
+        blocks = [n for n in archive.namelist() if n.startswith(prefix)]
+        blocks.sort(key=lambda n: int(n[len(prefix):]))
+        probes[name] = b"".join(archive.read(n) for n in blocks)
+
+    return rate, probes
+
+
+def decode_uart(raw, rate):
+    """Returns (time in seconds, byte) for every correctly framed byte, bytes with a parity or stop bit error are
+    dropped."""
+    bits_per_symbol = rate / BAUD
+    total = len(raw) * 8
+    result = []
+
+    def sample(pos):
+        return (raw[pos >> 3] >> (pos & 7)) & 1
+
+    pos = 0
+    while True:
+        # Skip the idle line byte-wise, then find the start bit in the first byte that has one
+        if pos & 7 or raw[pos >> 3 : (pos >> 3) + 1] != b"\xff":
+            while pos < total and pos & 7 and sample(pos):
+                pos += 1
+        if pos < total and sample(pos):
+            match = NOT_IDLE.search(raw, pos >> 3)
+            if match is None:
+                break
+            pos = match.start() * 8
+            while sample(pos):
+                pos += 1
+        if pos >= total:
+            break
+
+        start = pos
+        points = [int(start + bits_per_symbol * (k + 0.5)) for k in range(11)]
+        if points[-1] >= total:
+            break
+
+        levels = [sample(p) for p in points]
+        value = sum(levels[1 + k] << k for k in range(8))
+        if levels[0] == 0 and levels[10] == 1 and (bin(value).count("1") + levels[9]) % 2 == 0:
+            result.append((points[-1] / rate, value))
+            pos = points[-1]  # Middle of the stop bit
+        else:
+            pos = start + 1  # Glitch or misaligned, look for the next start bit
+
+    return result
+
+
+def split_frames(decoded):
+    """Groups bytes into frames at pauses longer than FRAME_GAP, returns (time of the last byte, bytes)."""
+    frames = []
+    last = None
+    for time, value in decoded:
+        if last is None or time - last > FRAME_GAP:
+            frames.append([time, bytearray()])
+        frames[-1][0] = time
+        frames[-1][1].append(value)
+        last = time
+    return [(time, bytes(data)) for time, data in frames]
+
+
+def capture_frames(path):
+    """Returns (time, outgoing, frame) of both directions sorted by time, outgoing frames were sent by the adapter."""
+    rate, probes = read_capture(path)
+    frames = []
+    for name, outgoing in (("RX", False), ("TX", True)):
+        if name in probes:
+            frames += [(t, outgoing, f) for t, f in split_frames(decode_uart(probes[name], rate))]
+    frames.sort(key=lambda entry: entry[0])
+    return frames
+
+
+def is_valid_frame(frame):
+    return len(frame) >= 5 and frame[0] == 0x5A and sum(frame) & 0xFF == 0
+
+
+def flight_recorder_lines(frames):
+    start = frames[0][0] if frames else 0
+    for time, outgoing, frame in frames:
+        timestamp = int(round((time - start) * 1e6)) & 0xFFFFFFFF
+        record = bytes([1 if outgoing else 0]) + timestamp.to_bytes(4, "little") + bytes([len(frame)]) + frame
+        yield "FR: " + base64.b64encode(record).decode()
+
+
+def write_corpus(directory, paths):
+    """Writes the valid frames of the captures to directory, named by their SHA-1 like libFuzzer does."""
+    os.makedirs(directory, exist_ok=True)
+    written = set()
+    for path in paths:
+        for _, _, frame in capture_frames(path):
+            name = hashlib.sha1(frame).hexdigest()
+            if is_valid_frame(frame) and name not in written:
+                with open(os.path.join(directory, name), "wb") as file:
+                    file.write(frame)
+                written.add(name)
+    return len(written)
+
+
+def main(argv):
+    if len(argv) < 3 or argv[1] not in ("frames", "flight-recorder", "corpus"):
+        sys.stderr.write(__doc__)
+        return 2
+
+    if argv[1] == "corpus":
+        if len(argv) < 4:
+            sys.stderr.write(__doc__)
+            return 2
+        print("%d frames written to %s" % (write_corpus(argv[2], argv[3:]), argv[2]))
+        return 0
+
+    if argv[1] == "flight-recorder":
+        for line in flight_recorder_lines(capture_frames(argv[2])):
+            print(line)
+        return 0
+
+    for path in argv[2:]:
+        print(path)
+        for time, outgoing, frame in capture_frames(path):
+            print("  %9.3f %s %s%s" % (time, "TX" if outgoing else "RX", frame.hex(" ").upper(),
+                                      "" if is_valid_frame(frame) else "  (invalid)"))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
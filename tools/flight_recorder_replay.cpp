@@ -0,0 +1,244 @@
+/*
+ * Replays a flight recorder dump through the protocol drivers on the host
+ *
+ * The dump is the "FR: <base64>" lines logged by dump_flight_recorder(), other lines are ignored, so a complete ESPHome
+ * log can be passed in. The packets are fed to a driver in passive mode at their recorded times: received packets on
+ * the AC side, sent packets on the controller side. The driver decodes them with the same code as on the ESP, every
+ * state it publishes is printed with the time since the first packet.
+ *
+ *   flight_recorder_replay [-v] [cnt|wlan] [dump.log]
+ *
+ * The protocol is detected from the first packet if it is not given, the dump is read from stdin if no file is given.
+ * -v adds the log of the driver.
+ */
+
+#include "esppac_cnt.h"
+#include "esppac_wlan.h"
+#include "panasonic_ac_select.h"
+#include "panasonic_ac_switch.h"
+
+#include "host.h"
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace esphome;
+using namespace esphome::panasonic_ac;
+
+static const uint64_t START_US = 1000000;  // Time of the first packet, setup() runs at 0
+
+struct Packet {
+  uint64_t time;  // Microseconds since the first packet
+  bool outgoing;
+  std::vector<uint8_t> data;
+};
+
+/*
+ * Parses the dump, the 32 bit timestamps wrap around every 71 minutes so they are turned into offsets
+ */
+static bool parse_dump(std::istream &input, std::vector<Packet> &packets) {
+  std::string line;
+  uint32_t first = 0, previous = 0;
+  uint64_t offset = 0;
+
+  while (std::getline(input, line)) {
+    size_t pos = line.find("FR: ");
+    if (pos == std::string::npos)
+      continue;
+
+    std::vector<uint8_t> record = base64_decode(line.substr(pos + 4));
+    if (record.size() < 6 || record.size() != 6u + record[5]) {
+      fprintf(stderr, "Invalid record: %s\n", line.c_str());
+      return false;
+    }
+
+    uint32_t timestamp = record[1] | (record[2] << 8) | (record[3] << 16) | ((uint32_t) record[4] << 24);
+
+    if (packets.empty())
+      first = previous = timestamp;
+
+    offset += (uint32_t) (timestamp - previous);
+    previous = timestamp;
+
+    packets.push_back({offset, record[0] != 0, std::vector<uint8_t>(record.begin() + 6, record.end())});
+  }
+
+  (void) first;
+  return true;
+}
+
+static double seconds() { return (double) ((int64_t) host::time_us() - (int64_t) START_US) / 1e6; }
+
+/*
+ * Entities of the driver, every publish is printed
+ */
+struct Entities {
+  PanasonicACSelect vertical_swing, horizontal_swing;
+  PanasonicACSwitch nanoex, eco, econavi, mild_dry;
+  sensor::Sensor outside_temperature, power_consumption;
+  binary_sensor::BinarySensor defrost;
+  text_sensor::TextSensor unknown_fields;
+
+  Entities() {
+    vertical_swing.set_name("vertical_swing");
+    vertical_swing.traits.set_options({"swing", "auto", "up", "up_center", "center", "down_center", "down"});
+    horizontal_swing.set_name("horizontal_swing");
+    horizontal_swing.traits.set_options({"auto", "left", "left_center", "center", "right_center", "right"});
+
+    for (auto *select : {&vertical_swing, &horizontal_swing})
+      select->add_on_state_callback([select](size_t) {
+        printf("%10.3f %s: %s\n", seconds(), select->get_name().c_str(), select->current_option().c_str());
+      });
+
+    nanoex.set_name("nanoex");
+    eco.set_name("eco");
+    econavi.set_name("econavi");
+    mild_dry.set_name("mild_dry");
+
+    for (auto *a_switch : {&nanoex, &eco, &econavi, &mild_dry})
+      a_switch->add_on_state_callback([a_switch](bool state) {
+        printf("%10.3f %s: %s\n", seconds(), a_switch->get_name().c_str(), state ? "ON" : "OFF");
+      });
+
+    outside_temperature.add_on_state_callback(
+        [](float state) { printf("%10.3f outside_temperature: %.1f\n", seconds(), state); });
+    power_consumption.add_on_state_callback(
+        [](float state) { printf("%10.3f power_consumption: %.0f\n", seconds(), state); });
+    defrost.add_on_state_callback([](bool state) { printf("%10.3f defrost: %s\n", seconds(), state ? "ON" : "OFF"); });
+    unknown_fields.add_on_state_callback(
+        [](const std::string &state) { printf("%10.3f unknown_fields: %s\n", seconds(), state.c_str()); });
+  }
+};
+
+template<typename Driver> static void attach_common(Driver &driver, Entities &entities) {
+  driver.set_vertical_swing_select(&entities.vertical_swing);
+  driver.set_horizontal_swing_select(&entities.horizontal_swing);
+  driver.set_nanoex_switch(&entities.nanoex);
+  driver.set_outside_temperature_sensor(&entities.outside_temperature);
+  driver.set_defrost_sensor(&entities.defrost);
+}
+
+static void print_climate(climate::Climate &climate) {
+  printf("%10.3f climate: mode=%s target=%.1f current=%.1f fan=%s swing=%s preset=%s action=%s\n", seconds(),
+         climate::climate_mode_to_string(climate.mode), climate.target_temperature, climate.current_temperature,
+         climate.get_custom_fan_mode().c_str(), climate::climate_swing_mode_to_string(climate.swing_mode),
+         climate.get_custom_preset().c_str(), climate::climate_action_to_string(climate.action));
+}
+
+/*
+ * Runs the loop at every deadline of the driver up to time
+ */
+static void run_until(PanasonicAC &driver, uint64_t time) {
+  while (true) {
+    uint32_t wait = driver.get_time_to_next_deadline();
+    uint64_t deadline = host::time_us() + (uint64_t) wait * 1000;
+
+    if (wait == UINT32_MAX || deadline > time)
+      break;
+
+    host::set_time_us(deadline);
+    driver.loop();
+  }
+
+  host::set_time_us(time);
+  driver.loop();
+}
+
+static int replay(PanasonicAC &driver, const std::vector<Packet> &packets, uart::FifoUART &ac_side,
+                  uart::FifoUART &controller_side) {
+  driver.add_on_state_callback(print_climate);
+  driver.setup();
+
+  for (const Packet &packet : packets) {
+    run_until(driver, START_US + packet.time);
+    (packet.outgoing ? controller_side : ac_side).receive(packet.data);
+    driver.loop();
+  }
+
+  run_until(driver, host::time_us() + 1000000);  // Let the last packet complete
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  bool verbose = false;
+  std::string type, path;
+
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+
+    if (arg == "-v")
+      verbose = true;
+    else if (arg == "cnt" || arg == "wlan")
+      type = arg;
+    else if (path.empty())
+      path = arg;
+    else {
+      fprintf(stderr, "Usage: %s [-v] [cnt|wlan] [dump.log]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  std::vector<Packet> packets;
+  bool parsed;
+
+  if (path.empty()) {
+    parsed = parse_dump(std::cin, packets);
+  } else {
+    std::ifstream file(path);
+    if (!file) {
+      fprintf(stderr, "Cannot open %s\n", path.c_str());
+      return 2;
+    }
+    parsed = parse_dump(file, packets);
+  }
+
+  if (!parsed)
+    return 1;
+
+  if (packets.empty()) {
+    fprintf(stderr, "No flight recorder packets found\n");
+    return 1;
+  }
+
+  if (type.empty()) {
+    uint8_t header = packets.front().data.empty() ? 0 : packets.front().data[0];
+    type = header == WLAN::HEADER || header == WLAN::SYNC_HEADER ? "wlan" : "cnt";
+  }
+
+  host::set_log_level(verbose ? ESPHOME_LOG_LEVEL_VERBOSE : ESPHOME_LOG_LEVEL_NONE);
+  host::set_log_sink([](int level, const char *tag, const char *message) {
+    static const char LETTERS[] = "NEWICDVV";
+    printf("%10.3f [%c][%s]: %s\n", seconds(), LETTERS[level & 7], tag, message);
+  });
+
+  printf("Replaying %zu packets using the %s driver\n", packets.size(), type == "wlan" ? "CN-WLAN" : "CN-CNT");
+
+  uart::FifoUART ac_side, controller_side;
+  Entities entities;
+
+  if (type == "wlan") {
+    WLAN::PanasonicACWLAN driver;
+    driver.set_uart_parent(&ac_side);
+    driver.set_passive(true);
+    driver.set_controller_uart(&controller_side);
+    attach_common(driver, entities);
+    driver.set_unknown_fields_sensor(&entities.unknown_fields);
+    return replay(driver, packets, ac_side, controller_side);
+  }
+
+  CNT::PanasonicACCNT driver;
+  driver.set_uart_parent(&ac_side);
+  driver.set_passive(true);
+  driver.set_controller_uart(&controller_side);
+  attach_common(driver, entities);
+  driver.set_eco_switch(&entities.eco);
+  driver.set_econavi_switch(&entities.econavi);
+  driver.set_mild_dry_switch(&entities.mild_dry);
+  driver.set_current_power_consumption_sensor(&entities.power_consumption);
+  return replay(driver, packets, ac_side, controller_side);
+}
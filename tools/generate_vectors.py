@@ -0,0 +1,391 @@
+#!/usr/bin/env python3
+"""Generate the golden vectors of tests/vectors/ from the protocol documentation and the logic analyzer captures.
+
+CN-CNT: protocol/cztacg1/protocol_description_query.ods documents the poll request, a poll response with the purpose
+of every byte and the values of the mode, fan speed, swing, preset, mild dry and eco fields. The documented response
+is one vector, every documented value of a field is another one, written into the documented response. The expected
+state of each response is decoded here from the documented tables, independently of the C++ register tables.
+
+CN-WLAN: the frames of the captures in protocol/logic_analyzer/controller/ are decoded with tools/dsl_uart.py. The
+key/value pairs of the query responses and reports of the AC are decoded here with the keys and values documented in
+the "AC query response" table of protocol/protocol_description_controller.ods. The expected state after each of them
+is the state reported by the AC so far.
+
+    generate_vectors.py [output dir]       Default: tests/vectors
+
+The output is committed, tests/vectors_test.cpp runs the vectors against the drivers on the host.
+"""
+
+import glob
+import os
+import re
+import sys
+import zipfile
+from xml.etree import ElementTree
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import dsl_uart  # noqa: E402
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+QUERY_ODS = "protocol/cztacg1/protocol_description_query.ods"
+CONTROLLER_ODS = "protocol/protocol_description_controller.ods"
+CAPTURES = "protocol/logic_analyzer/controller/*.dsl"
+
+TABLE = "urn:oasis:names:tc:opendocument:xmlns:table:1.0"
+TEXT = "urn:oasis:names:tc:opendocument:xmlns:text:1.0"
+
+
+def read_sheet(path):
+    """Returns the rows of the first sheet as lists of cell texts, repeated cells and rows expanded."""
+    root = ElementTree.fromstring(zipfile.ZipFile(os.path.join(ROOT, path)).read("content.xml"))
+    sheet = next(root.iter("{%s}table" % TABLE))
+    rows = []
+    for row in sheet.iter("{%s}table-row" % TABLE):
+        cells = []
+        for cell in row.findall("{%s}table-cell" % TABLE):
+            repeat = min(int(cell.get("{%s}number-columns-repeated" % TABLE, "1")), 64)
+            text = " ".join("".join(p.itertext()) for p in cell.findall("{%s}p" % TEXT))
+            cells += [text] * repeat
+        while cells and not cells[-1]:
+            cells.pop()
+        rows += [cells] * min(int(row.get("{%s}number-rows-repeated" % TABLE, "1")), 64)
+    return rows
+
+
+def cell(row, column):
+    return row[column] if column < len(row) else ""
+
+
+def is_hex(text):
+    return re.fullmatch(r"[0-9A-F]{2}", text) is not None
+
+
+def c_bytes(data):
+    return "{" + ", ".join("0x%02X" % b for b in data) + "}"
+
+
+def c_string(text):
+    return "nullptr" if text is None else '"%s"' % text
+
+
+def c_float(value):
+    return "NAN" if value is None else "%.1ff" % value
+
+
+def c_bool(value):
+    return "-1" if value is None else ("1" if value else "0")
+
+
+HEADER = """// Generated by tools/generate_vectors.py from %s, do not edit
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+"""
+
+#
+# CN-CNT
+#
+
+# Names of the spreadsheet -> states of the driver, the only knowledge that does not come from the spreadsheet
+CNT_MODES = {"Heat/Cool": "HEAT_COOL", "Cool": "COOL", "Heat": "HEAT", "Dry": "DRY", "Fan only": "FAN_ONLY", "Off": "OFF"}
+CNT_FAN_SPEEDS = {"Auto": "Automatic", "1": "1", "2": "2", "3": "3", "4": "4", "5": "5"}
+CNT_TABLES = ("Modes", "Fan speeds", "Swing mode", "Presets", "Mild dry", "Eco mode")
+
+
+def cnt_checksum(frame):
+    return -sum(frame) & 0xFF
+
+
+def parse_query_sheet():
+    """Returns the request, the response, the purpose of each response byte and the value tables."""
+    rows = read_sheet(QUERY_ODS)
+    request, response, purposes = [], [], []
+    tables = {}
+    target = request
+    table = None
+
+    for row in rows:
+        if cell(row, 1) == "AC to controller":
+            target = response
+        if re.fullmatch(r"\d+", cell(row, 0)) and is_hex(cell(row, 1)):
+            assert int(cell(row, 0)) == len(target), "Byte %s out of order" % cell(row, 0)
+            target.append(int(cell(row, 1), 16))
+            if target is response:
+                purposes.append(cell(row, 2))
+
+        name = cell(row, 5)
+        if name in CNT_TABLES:
+            table = tables.setdefault(name, [])
+            if name == "Swing mode":
+                tables["Swing columns"] = [cell(row, 6 + i) for i in range(6)]
+        elif name and table is not None:
+            values = [cell(row, 6 + i) for i in range(6 if table is tables.get("Swing mode") else 1)]
+            if all(is_hex(v) for v in values):
+                table.append((name, [int(v, 16) for v in values]))
+
+    assert sum(request) & 0xFF == 0 and sum(response) & 0xFF == 0, "Documented checksums do not add up"
+    return request, response, purposes, tables
+
+
+def cnt_vectors():
+    request, response, purposes, tables = parse_query_sheet()
+
+    def offset(purpose):
+        return purposes.index(purpose)
+
+    mode_at = offset("Mode")
+    swing_at = offset("Horizontal & vertical swing")
+    preset_at = offset("Powerful/Quiet/nanoex/Econavi")
+    fields = {
+        "Modes": mode_at,
+        "Fan speeds": offset("Fan speed"),
+        "Swing mode": swing_at,
+        "Presets": preset_at,
+        "Mild dry": offset("Mild dry"),
+        "Eco mode": offset("Eco mode"),
+    }
+
+    def lookup(table, value):
+        return next(name for name, values in tables[table] if values[0] == value)
+
+    def decode(frame):
+        vertical, horizontal = next((vertical, tables["Swing columns"][values.index(frame[swing_at])])
+                                    for vertical, values in tables["Swing mode"] if frame[swing_at] in values)
+        preset = lookup("Presets", frame[preset_at])
+        swing = {(True, True): "BOTH", (True, False): "VERTICAL", (False, True): "HORIZONTAL", (False, False): "OFF"}
+        return {
+            "mode": CNT_MODES[lookup("Modes", frame[mode_at])],
+            "target_temperature": frame[offset("Target temperature * 2")] / 2,
+            "current_temperature": frame[offset("Current temperature")],
+            "outside_temperature": frame[offset("Outside temperature")],
+            "fan_mode": CNT_FAN_SPEEDS[lookup("Fan speeds", frame[fields["Fan speeds"]])],
+            "swing_mode": swing[(vertical == "auto", horizontal == "auto")],
+            "vertical_swing": vertical,
+            "horizontal_swing": horizontal,
+            "preset": "Normal" if preset == "Econavi" else preset.split("+")[0],
+            "nanoex": preset.endswith("+nanoex"),
+            "econavi": preset == "Econavi",
+            "mild_dry": lookup("Mild dry", frame[fields["Mild dry"]]) == "On",
+            "eco": lookup("Eco mode", frame[fields["Eco mode"]]) == "On",
+        }
+
+    vectors = [("documented response", response)]
+    for table, at in fields.items():
+        for name, values in tables[table]:
+            columns = tables["Swing columns"] if table == "Swing mode" else [None]
+            for column, value in zip(columns, values):
+                frame = list(response)
+                frame[at] = value
+                frame[-1] = cnt_checksum(frame[:-1])
+                label = "%s %s" % (name, column) if column else name
+                vectors.append(("%s: %s" % (table.lower(), label), frame))
+
+    lines = [HEADER % QUERY_ODS]
+    lines.append("namespace vectors {\n\n")
+    lines.append("static const std::vector<uint8_t> CNT_QUERY_REQUEST%s;\n\n" % c_bytes(request))
+    lines.append("""// Poll response and the state the driver must decode from it
+struct CNTVector {
+  const char *name;
+  std::vector<uint8_t> frame;
+  const char *mode;  // climate_mode_to_string()
+  float target_temperature;
+  float current_temperature;
+  float outside_temperature;
+  const char *fan_mode;
+  const char *swing_mode;  // climate_swing_mode_to_string()
+  const char *vertical_swing;
+  const char *horizontal_swing;
+  const char *preset;
+  bool nanoex;
+  bool econavi;
+  bool mild_dry;
+  bool eco;
+};
+
+static const CNTVector CNT_VECTORS[]{
+""")
+    for name, frame in vectors:
+        d = decode(frame)
+        lines.append("    {%s,\n     %s,\n     %s, %s, %s, %s, %s, %s, %s, %s, %s, %s, %s, %s, %s},\n" % (
+            c_string(name), c_bytes(frame), c_string(d["mode"]), c_float(d["target_temperature"]),
+            c_float(d["current_temperature"]), c_float(d["outside_temperature"]), c_string(d["fan_mode"]),
+            c_string(d["swing_mode"]), c_string(d["vertical_swing"]), c_string(d["horizontal_swing"]),
+            c_string(d["preset"]), str(d["nanoex"]).lower(), str(d["econavi"]).lower(),
+            str(d["mild_dry"]).lower(), str(d["eco"]).lower()))
+    lines.append("};\n\n}  // namespace vectors\n")
+    return "".join(lines), len(vectors)
+
+
+#
+# CN-WLAN
+#
+
+# Names of the spreadsheet -> states of the driver
+WLAN_MODES = {"Auto": "HEAT_COOL", "Heat": "HEAT", "Cool": "COOL", "Dry": "DRY", "nanoe/fan only": "FAN_ONLY"}
+WLAN_FAN_SPEEDS = {"Auto": "Automatic"}
+
+# The spreadsheet has 42 = off, 43 = vertical, 41 = horizontal. air_swing_updown_both_leftright_off.dsl sets 43, 41,
+# 44 and 42 in that order, which makes 41 both and 44 horizontal.
+WLAN_SWING_MODES = {0x41: "BOTH", 0x42: "OFF", 0x43: "VERTICAL", 0x44: "HORIZONTAL"}
+
+WLAN_FIELDS = {  # Header description in the spreadsheet -> field of the state
+    "Power state header": "power",
+    "Mode header": "mode",
+    "Target temperature header": "target_temperature",
+    "Fan speed header": "fan_mode",
+    "Swing automatic mode header": "swing_mode",
+    "Horizontal swing position header": "horizontal_swing",
+    "Vertical swing position header": "vertical_swing",
+    "Power mode": "preset",
+    "nanoex header": "nanoex",
+    "Inside temperature header": "current_temperature",
+    "Outside temperature header": "outside_temperature",
+}
+
+WLAN_QUERY_RESPONSE_SIZE = 125
+
+
+def parse_value_names(description):
+    """'Down (42), Down center (45)' -> {0x42: 'Down', 0x45: 'Down center'}, 'On (45/43)' gives both values."""
+    names = {}
+    for name, values in re.findall(r"([^,()]+?) \(([0-9A-F]{2}(?:/[0-9A-F]{2})*)\)", description):
+        for value in values.split("/"):
+            names[int(value, 16)] = name.strip()
+    return names
+
+
+def parse_controller_sheet():
+    """Returns key -> (field, decoder) from the "AC query response" table of the controller spreadsheet."""
+    rows = read_sheet(CONTROLLER_ODS)
+    start = next(i for i, row in enumerate(rows) if "AC query response" in row)
+    column = rows[start].index("AC query response") + 2
+    table = [(cell(row, column + 1), cell(row, column + 2)) for row in rows[start:] if cell(row, column).isdigit()]
+
+    keys = {}
+    for index, (value, description) in enumerate(table):
+        if description not in WLAN_FIELDS or index + 2 >= len(table):
+            continue
+        field = WLAN_FIELDS[description]
+        names = parse_value_names(table[index + 2][1])
+
+        if field == "power":
+            decoder = lambda v, n=names: n[v] == "On"
+        elif field == "mode":
+            decoder = lambda v, n=names: WLAN_MODES[n[v]]
+        elif field == "target_temperature":
+            decoder = lambda v: v / 2
+        elif field == "fan_mode":
+            decoder = lambda v, n=names: WLAN_FAN_SPEEDS.get(n[v], n[v])
+        elif field == "swing_mode":
+            decoder = lambda v: WLAN_SWING_MODES[v]
+        elif field in ("horizontal_swing", "vertical_swing"):
+            decoder = lambda v, n=names: n[v].lower().replace(" ", "_")
+        elif field == "preset":
+            decoder = lambda v, n=names: n[v].split("/")[0]
+        elif field == "nanoex":
+            decoder = lambda v, n=names: n[v] == "On"
+        else:
+            decoder = lambda v: v - 256 if v >= 128 else v
+        keys[int(value, 16)] = (field, decoder)
+
+    assert len(keys) == len(WLAN_FIELDS), "Missing keys in the controller spreadsheet"
+    return keys
+
+
+def decode_pairs(frame):
+    """Key value pairs of a query response, report or set command: the count at 10, then key, 01, value and a flag."""
+    return [(frame[12 + i * 4], frame[14 + i * 4]) for i in range(frame[10]) if 14 + i * 4 < len(frame)]
+
+
+def wlan_vectors():
+    keys = parse_controller_sheet()
+    captures = []
+
+    for path in sorted(glob.glob(os.path.join(ROOT, CAPTURES))):
+        frames = [f for f in dsl_uart.capture_frames(path) if dsl_uart.is_valid_frame(f[2])]
+        if not frames:
+            continue
+
+        state = {}
+        entries = []
+        start = frames[0][0]
+        for time, outgoing, frame in frames:
+            checked = not outgoing and frame[2] == 0x10 and (
+                (frame[3] == 0x89 and len(frame) == WLAN_QUERY_RESPONSE_SIZE) or frame[3] == 0x0A)
+            if checked:
+                for key, value in decode_pairs(frame):
+                    if key in keys:
+                        field, decoder = keys[key]
+                        state[field] = decoder(value)
+            # The climate mode is off while the power is, the mode is only known with the power
+            expected = dict(state)
+            power = expected.pop("power", None)
+            if power is None:
+                expected.pop("mode", None)
+            elif not power:
+                expected["mode"] = "OFF"
+            entries.append((int(round((time - start) * 1e6)), outgoing, frame, checked, expected))
+        captures.append((os.path.basename(path), entries))
+
+    lines = [HEADER % ("the captures in protocol/logic_analyzer/controller/ and " + CONTROLLER_ODS)]
+    lines.append("namespace vectors {\n\n")
+    lines.append("""// Frame of a capture and, after the frames of the AC that carry state, the state reported by the AC so far. Fields the
+// AC has not reported yet are nullptr, NAN or -1.
+struct WLANFrame {
+  uint32_t time;  // Microseconds since the first frame
+  bool outgoing;  // Sent by the adapter
+  std::vector<uint8_t> data;
+  bool checked;      // The state below is checked after this frame
+  const char *mode;  // climate_mode_to_string()
+  float target_temperature;
+  float current_temperature;
+  float outside_temperature;
+  const char *fan_mode;
+  const char *swing_mode;  // climate_swing_mode_to_string()
+  const char *vertical_swing;
+  const char *horizontal_swing;
+  const char *preset;
+  int nanoex;
+};
+
+struct WLANCapture {
+  const char *name;
+  std::vector<WLANFrame> frames;
+};
+
+static const WLANCapture WLAN_CAPTURES[]{
+""")
+    count = 0
+    for name, entries in captures:
+        lines.append("    {%s,\n     {\n" % c_string(name))
+        for time, outgoing, frame, checked, e in entries:
+            lines.append("         {%d, %s, %s, %s, %s, %s, %s, %s, %s, %s, %s, %s, %s, %s},\n" % (
+                time, str(outgoing).lower(), c_bytes(frame), str(checked).lower(), c_string(e.get("mode")),
+                c_float(e.get("target_temperature")), c_float(e.get("current_temperature")),
+                c_float(e.get("outside_temperature")), c_string(e.get("fan_mode")), c_string(e.get("swing_mode")),
+                c_string(e.get("vertical_swing")), c_string(e.get("horizontal_swing")), c_string(e.get("preset")),
+                c_bool(e.get("nanoex"))))
+            count += checked
+        lines.append("     }},\n")
+    lines.append("};\n\n}  // namespace vectors\n")
+    return "".join(lines), count
+
+
+def main(argv):
+    output = argv[1] if len(argv) > 1 else os.path.join(ROOT, "tests", "vectors")
+    os.makedirs(output, exist_ok=True)
+
+    for name, generate in (("cnt_vectors.h", cnt_vectors), ("wlan_vectors.h", wlan_vectors)):
+        text, count = generate()
+        with open(os.path.join(output, name), "w") as file:
+            file.write(text)
+        print("%s: %d vectors" % (name, count))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,241 @@
+/*
+ * Drives an AC from Linux through a USB-serial adapter, with the same protocol code as on the ESP
+ *
+ * The driver runs on the host implementation of the ESPHome API in host/ on the real clock. The loop sleeps in poll()
+ * until the serial port or stdin has data or the next deadline of the driver is reached, like the idle-gated loop on
+ * the ESP. Every state the driver publishes is printed, commands are read from stdin, one per line:
+ *
+ *   mode off|heat_cool|cool|heat|fan_only|dry
+ *   temperature <degrees>
+ *   fan <fan mode>
+ *   swing off|both|vertical|horizontal
+ *   preset <preset>
+ *   quit
+ *
+ *   panasonic_acd [-v] [-t seconds] [cnt|wlan|auto] device
+ *
+ * The serial port is set to 9600 baud 8E1, the protocol is detected if it is not given. -t stops after the given time,
+ * -v adds the log of the driver. The daemon exits when the driver asks for a reboot, so a supervisor restarts it.
+ * tools/pty_ac_simulator provides a simulated AC on a pty to try it without one.
+ */
+
+#include "esppac_auto.h"
+#include "esppac_cnt.h"
+#include "esppac_wlan.h"
+
+#include "host.h"
+
+#include <fcntl.h>
+#include <poll.h>
+#include <strings.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+using namespace esphome;
+using namespace esphome::panasonic_ac;
+
+static uint64_t start_us = 0;
+
+static double seconds() { return (double) (host::time_us() - start_us) / 1e6; }
+
+static void print_climate(climate::Climate &climate) {
+  printf("%10.3f climate: mode=%s target=%.1f current=%.1f fan=%s swing=%s preset=%s action=%s\n", seconds(),
+         climate::climate_mode_to_string(climate.mode), climate.target_temperature, climate.current_temperature,
+         climate.get_custom_fan_mode().c_str(), climate::climate_swing_mode_to_string(climate.swing_mode),
+         climate.get_custom_preset().c_str(), climate::climate_action_to_string(climate.action));
+  fflush(stdout);
+}
+
+/*
+ * Opens the serial port non-blocking in raw mode, 9600 baud 8E1 like both protocols
+ */
+static int open_serial_port(const char *path) {
+  int fd = open(path, O_RDWR | O_NOCTTY | O_NONBLOCK);
+  if (fd < 0)
+    return -1;
+
+  struct termios tty;
+  if (tcgetattr(fd, &tty) == 0) {
+    cfmakeraw(&tty);
+    cfsetispeed(&tty, B9600);
+    cfsetospeed(&tty, B9600);
+    tty.c_cflag |= CLOCAL | CREAD | PARENB;
+    tty.c_cflag &= ~(PARODD | CSTOPB);
+    tcsetattr(fd, TCSANOW, &tty);
+  }
+
+  return fd;
+}
+
+static bool parse_mode(const std::string &text, climate::ClimateMode &mode) {
+  for (uint8_t i = climate::CLIMATE_MODE_OFF; i <= climate::CLIMATE_MODE_AUTO; i++) {
+    if (strcasecmp(text.c_str(), climate::climate_mode_to_string((climate::ClimateMode) i)) == 0) {
+      mode = (climate::ClimateMode) i;
+      return true;
+    }
+  }
+  return false;
+}
+
+static bool parse_swing_mode(const std::string &text, climate::ClimateSwingMode &swing_mode) {
+  for (uint8_t i = climate::CLIMATE_SWING_OFF; i <= climate::CLIMATE_SWING_HORIZONTAL; i++) {
+    if (strcasecmp(text.c_str(), climate::climate_swing_mode_to_string((climate::ClimateSwingMode) i)) == 0) {
+      swing_mode = (climate::ClimateSwingMode) i;
+      return true;
+    }
+  }
+  return false;
+}
+
+/*
+ * Runs one command line, returns false on quit
+ */
+static bool run_command(climate::Climate &climate, const std::string &line) {
+  size_t space = line.find(' ');
+  std::string command = line.substr(0, space);
+  std::string argument = space == std::string::npos ? "" : line.substr(space + 1);
+  auto call = climate.make_call();
+
+  if (command == "quit")
+    return false;
+
+  if (command == "mode") {
+    climate::ClimateMode mode;
+    if (!parse_mode(argument, mode)) {
+      fprintf(stderr, "Unknown mode: %s\n", argument.c_str());
+      return true;
+    }
+    call.set_mode(mode);
+  } else if (command == "temperature") {
+    call.set_target_temperature(strtof(argument.c_str(), nullptr));
+  } else if (command == "fan") {
+    call.set_fan_mode(argument);
+  } else if (command == "swing") {
+    climate::ClimateSwingMode swing_mode;
+    if (!parse_swing_mode(argument, swing_mode)) {
+      fprintf(stderr, "Unknown swing mode: %s\n", argument.c_str());
+      return true;
+    }
+    call.set_swing_mode(swing_mode);
+  } else if (command == "preset") {
+    call.set_preset(argument);
+  } else if (!command.empty()) {
+    fprintf(stderr, "Unknown command: %s\n", command.c_str());
+    return true;
+  }
+
+  call.perform();
+  return true;
+}
+
+template<typename Driver> static int run(Driver &driver, uart::FileUART &port, uint64_t duration_us) {
+  driver.set_uart_parent(&port);
+  driver.add_on_state_callback(print_climate);
+  driver.setup();
+
+  bool input_open = true;
+  std::string line;
+
+  while (duration_us == 0 || host::time_us() - start_us < duration_us) {
+    uint32_t wait = driver.get_time_to_next_deadline();
+    int timeout = wait == UINT32_MAX ? 1000 : (int) std::min<uint32_t>(wait, 1000);
+
+    struct pollfd fds[2] = {{port.get_fd(), POLLIN, 0}, {STDIN_FILENO, POLLIN, 0}};
+    poll(fds, input_open ? 2 : 1, timeout);
+
+    if (input_open && (fds[1].revents & (POLLIN | POLLHUP))) {
+      char buffer[256];
+      ssize_t length = read(STDIN_FILENO, buffer, sizeof(buffer));
+
+      if (length <= 0)
+        input_open = false;  // Keeps running without commands
+
+      for (ssize_t i = 0; i < length; i++) {
+        if (buffer[i] != '\n') {
+          line += buffer[i];
+          continue;
+        }
+
+        if (!run_command(driver, line))
+          return 0;
+        line.clear();
+      }
+    }
+
+    driver.loop();
+
+    if (host::reboot_requested()) {
+      fprintf(stderr, "Driver requested a reboot\n");
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  bool verbose = false;
+  uint64_t duration_us = 0;
+  std::string type = "auto", path;
+
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+
+    if (arg == "-v") {
+      verbose = true;
+    } else if (arg == "-t" && i + 1 < argc) {
+      duration_us = (uint64_t) (atof(argv[++i]) * 1e6);
+    } else if (arg == "cnt" || arg == "wlan" || arg == "auto") {
+      type = arg;
+    } else if (path.empty()) {
+      path = arg;
+    } else {
+      path.clear();
+      break;
+    }
+  }
+
+  if (path.empty()) {
+    fprintf(stderr, "Usage: %s [-v] [-t seconds] [cnt|wlan|auto] device\n", argv[0]);
+    return 2;
+  }
+
+  int fd = open_serial_port(path.c_str());
+  if (fd < 0) {
+    fprintf(stderr, "Cannot open %s: %s\n", path.c_str(), strerror(errno));
+    return 2;
+  }
+
+  host::use_real_clock(true);
+  start_us = host::time_us();
+
+  host::set_log_level(verbose ? ESPHOME_LOG_LEVEL_VERBOSE : ESPHOME_LOG_LEVEL_WARN);
+  host::set_log_sink([](int level, const char *tag, const char *message) {
+    static const char LETTERS[] = "NEWICDVV";
+    fprintf(stderr, "%10.3f [%c][%s]: %s\n", seconds(), LETTERS[level & 7], tag, message);
+  });
+
+  uart::FileUART port(fd);
+  int result;
+
+  if (type == "cnt") {
+    CNT::PanasonicACCNT driver;
+    result = run(driver, port, duration_us);
+  } else if (type == "wlan") {
+    WLAN::PanasonicACWLAN driver;
+    result = run(driver, port, duration_us);
+  } else {
+    PanasonicACAuto driver;
+    result = run(driver, port, duration_us);
+  }
+
+  close(fd);
+  return result;
+}
@@ -0,0 +1,143 @@
+/*
+ * Simulated AC on a pty, to run tools/panasonic_acd or any other serial client without an AC
+ *
+ * The AC is one of the simulated ACs of tests/sim, run on the real clock. The path of the pty is printed as the first
+ * line of stdout, then the client opens it like the device of a USB-serial adapter. Bytes from the client make up a
+ * frame until the line is quiet for FRAME_GAP, the frames of the AC are written to the pty as they are sent. The
+ * CN-WLAN AC sends its sync packet one second after the start, like after power on.
+ *
+ *   pty_ac_simulator [-t seconds] [cnt|wlan]
+ *
+ * Runs until interrupted or for the given time, then prints the frame counters to stderr.
+ */
+
+#include "sim/simulated_ac.h"
+#include "sim/simulation.h"
+
+#include "host.h"
+
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace esphome;
+
+static const uint64_t FRAME_GAP = 10000;  // Silence in µs that ends a frame of the client, several byte times
+
+static volatile sig_atomic_t stop = 0;
+
+/*
+ * Opens a pty in raw mode, the slave end is kept open so the master does not fail while no client is connected
+ */
+static int open_pty(std::string &path, int &slave) {
+  int master = posix_openpt(O_RDWR | O_NOCTTY);
+  if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0)
+    return -1;
+
+  path = ptsname(master);
+  slave = open(path.c_str(), O_RDWR | O_NOCTTY);
+  if (slave < 0)
+    return -1;
+
+  struct termios tty;
+  tcgetattr(slave, &tty);
+  cfmakeraw(&tty);
+  tcsetattr(slave, TCSANOW, &tty);
+
+  fcntl(master, F_SETFL, fcntl(master, F_GETFL) | O_NONBLOCK);
+  return master;
+}
+
+int main(int argc, char **argv) {
+  uint64_t duration_us = 0;
+  std::string type = "cnt";
+
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+
+    if (arg == "-t" && i + 1 < argc) {
+      duration_us = (uint64_t) (atof(argv[++i]) * 1e6);
+    } else if (arg == "cnt" || arg == "wlan") {
+      type = arg;
+    } else {
+      fprintf(stderr, "Usage: %s [-t seconds] [cnt|wlan]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  std::string path;
+  int slave;
+  int master = open_pty(path, slave);
+  if (master < 0) {
+    perror("Cannot open a pty");
+    return 1;
+  }
+
+  signal(SIGINT, [](int) { stop = 1; });
+  signal(SIGTERM, [](int) { stop = 1; });
+
+  host::use_real_clock(true);
+  uint64_t start = host::time_us();
+
+  sim::Simulation simulation;
+  uart::FifoUART link;  // AC side of the simulation, what the AC sends is read from it and written to the pty
+  std::unique_ptr<sim::SimulatedAC> ac;
+
+  if (type == "wlan") {
+    auto *wlan = new sim::WLANAC(simulation, link);
+    simulation.after_ms(1000, [wlan] { wlan->power_on(); });
+    ac.reset(wlan);
+  } else {
+    ac.reset(new sim::CNTAC(simulation, link));
+  }
+
+  printf("%s\n", path.c_str());
+  fflush(stdout);
+
+  std::vector<uint8_t> frame;
+  uint64_t last_byte = 0;
+
+  while (!stop && (duration_us == 0 || host::time_us() - start < duration_us)) {
+    uint64_t now = host::time_us();
+    uint64_t next = simulation.run_due();
+
+    if (!frame.empty()) {
+      if (now - last_byte >= FRAME_GAP) {
+        link.write_array(frame.data(), frame.size());
+        frame.clear();
+        continue;  // The frame may have scheduled an event
+      }
+      next = std::min(next, last_byte + FRAME_GAP);
+    }
+
+    std::vector<uint8_t> sent(link.available());
+    if (!sent.empty() && link.read_array(sent.data(), sent.size()) && write(master, sent.data(), sent.size()) < 0)
+      perror("Cannot write to the pty");
+
+    int timeout = next == UINT64_MAX ? 1000 : (int) std::min<uint64_t>((next - now + 999) / 1000, 1000);
+    struct pollfd readable = {master, POLLIN, 0};
+    poll(&readable, 1, timeout);
+
+    uint8_t buffer[256];
+    ssize_t length;
+    while ((length = read(master, buffer, sizeof(buffer))) > 0) {
+      frame.insert(frame.end(), buffer, buffer + length);
+      last_byte = host::time_us();
+    }
+  }
+
+  fprintf(stderr, "%zu frames received, %zu frames sent\n", ac->frames_received(), ac->frames_sent());
+
+  close(slave);
+  close(master);
+  return 0;
+}
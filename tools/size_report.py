@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+"""Report the code and RAM size of the component for every optional feature.
+
+Compiles the component sources against the minimal ESPHome API in host/ once without any feature, once per feature
+and once with all of them, the way climate.py enables them with USE_PANASONIC_AC_* defines. A file calling the setters
+of the enabled features stands in for the main.cpp generated by ESPHome. For every build it prints
+the summed text, data and bss size of the objects and the size of the CN-CNT and CN-WLAN driver objects, which are
+allocated once per AC. Single features are shown as the difference to the minimal build.
+
+    size_report.py [--source DIR] [--cxx COMPILER] [--log-level N]
+
+--source measures another checkout of components/panasonic_ac, e.g. an older revision from git worktree. The sizes
+are those of the host compiler, they show the differences between the builds but are not the sizes on an ESP.
+"""
+
+import argparse
+import glob
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+FEATURE = re.compile(r"USE_PANASONIC_AC_[A-Z_]+")
+
+# Calls every setter of a configured feature like the main.cpp generated by ESPHome, setters that are templates are
+# instantiated there
+CONFIGURE_PROGRAM = """
+#include "esppac_cnt.h"
+#include "esppac_wlan.h"
+
+using namespace esphome;
+using namespace esphome::panasonic_ac;
+
+template<typename Driver> void configure(Driver *driver, select::Select *select, switch_::Switch *a_switch,
+                                         sensor::Sensor *sensor, binary_sensor::BinarySensor *binary_sensor) {
+#ifdef USE_PANASONIC_AC_VERTICAL_SWING
+  driver->set_vertical_swing_select(select);
+#endif
+#ifdef USE_PANASONIC_AC_HORIZONTAL_SWING
+  driver->set_horizontal_swing_select(select);
+#endif
+#ifdef USE_PANASONIC_AC_NANOEX
+  driver->set_nanoex_switch(a_switch);
+#endif
+#ifdef USE_PANASONIC_AC_OUTSIDE_TEMPERATURE
+  driver->set_outside_temperature_sensor(sensor);
+#endif
+#ifdef USE_PANASONIC_AC_POWER_CONSUMPTION
+  driver->set_current_power_consumption_sensor(sensor);
+#endif
+#ifdef USE_PANASONIC_AC_DEFROST
+  driver->set_defrost_sensor(binary_sensor);
+#endif
+#ifdef USE_PANASONIC_AC_CURRENT_TEMPERATURE_SENSOR
+  driver->set_current_temperature_sensor(sensor);
+#endif
+}
+
+void configure_cnt(CNT::PanasonicACCNT *driver, select::Select *select, switch_::Switch *a_switch,
+                   sensor::Sensor *sensor, binary_sensor::BinarySensor *binary_sensor) {
+  configure(driver, select, a_switch, sensor, binary_sensor);
+#ifdef USE_PANASONIC_AC_ECO
+  driver->set_eco_switch(a_switch);
+#endif
+#ifdef USE_PANASONIC_AC_ECONAVI
+  driver->set_econavi_switch(a_switch);
+#endif
+#ifdef USE_PANASONIC_AC_MILD_DRY
+  driver->set_mild_dry_switch(a_switch);
+#endif
+}
+
+void configure_wlan(WLAN::PanasonicACWLAN *driver, select::Select *select, switch_::Switch *a_switch,
+                    sensor::Sensor *sensor, binary_sensor::BinarySensor *binary_sensor) {
+  configure(driver, select, a_switch, sensor, binary_sensor);
+}
+"""
+
+SIZEOF_PROGRAM = """
+#include "esppac_cnt.h"
+#include "esppac_wlan.h"
+#include <cstdio>
+
+int main() {
+  printf("%zu %zu\\n", sizeof(esphome::panasonic_ac::CNT::PanasonicACCNT),
+         sizeof(esphome::panasonic_ac::WLAN::PanasonicACWLAN));
+}
+"""
+
+
+def find_features(source):
+    features = set()
+    for path in glob.glob(os.path.join(source, "*.h")) + glob.glob(os.path.join(source, "*.cpp")):
+        with open(path, encoding="utf-8") as file:
+            features.update(FEATURE.findall(file.read()))
+    return sorted(features)
+
+
+def measure(args, defines, work):
+    """Returns (text, data, bss, CNT driver size, WLAN driver size) of a build with the given defines."""
+    flags = ["-std=gnu++17", "-Os", "-ffunction-sections", "-fdata-sections", "-w",
+             "-I", os.path.join(ROOT, "host"), "-I", args.source,
+             "-DESPHOME_LOG_LEVEL=%d" % args.log_level] + ["-D" + define for define in defines]
+
+    configure = os.path.join(work, "configure.cpp")
+    with open(configure, "w", encoding="utf-8") as file:
+        file.write(CONFIGURE_PROGRAM)
+
+    objects = []
+    for source in sorted(glob.glob(os.path.join(args.source, "*.cpp"))) + [configure]:
+        obj = os.path.join(work, os.path.basename(source) + ".o")
+        subprocess.run([args.cxx] + flags + ["-c", source, "-o", obj], check=True)
+        objects.append(obj)
+
+    output = subprocess.run(["size", "--totals"] + objects, check=True, capture_output=True, text=True).stdout
+    text, data, bss = (int(value) for value in output.splitlines()[-1].split()[:3])
+
+    program = os.path.join(work, "sizeof.cpp")
+    with open(program, "w", encoding="utf-8") as file:
+        file.write(SIZEOF_PROGRAM)
+    binary = os.path.join(work, "sizeof")
+    subprocess.run([args.cxx] + flags + [program, "-o", binary], check=True)
+    cnt, wlan = (int(value) for value in subprocess.run([binary], check=True, capture_output=True,
+                                                           text=True).stdout.split())
+
+    return text, data, bss, cnt, wlan
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--source", default=os.path.join(ROOT, "components", "panasonic_ac"))
+    parser.add_argument("--cxx", default=os.environ.get("CXX", "g++"))
+    parser.add_argument("--log-level", type=int, default=5, help="ESPHOME_LOG_LEVEL, default DEBUG like ESPHome")
+    args = parser.parse_args()
+    args.source = os.path.abspath(args.source)
+
+    features = find_features(args.source)
+    builds = [("minimal", [])]
+    builds += [(feature[len("USE_PANASONIC_AC_"):].lower(), [feature]) for feature in features]
+    if features:
+        builds.append(("full", features))
+
+    print("%-28s %8s %6s %6s %10s %11s" % ("Build", "text", "data", "bss", "CNT object", "WLAN object"))
+
+    with tempfile.TemporaryDirectory() as work:
+        base = None
+        for name, defines in builds:
+            sizes = measure(args, defines, work)
+            if base is None:
+                base = sizes
+            if defines == [] or defines == features:
+                print("%-28s %8d %6d %6d %10d %11d" % ((name,) + sizes))
+            else:
+                print("%-28s %+8d %+6d %+6d %+10d %+11d" % ((name,) + tuple(s - b for s, b in zip(sizes, base))))
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())